@@ -26,7 +26,7 @@ fi
 CFLAGS="$BASE_CFLAGS"
 TST_CFLAGS="$CFLAGS -DTSTDBG"
 LDFLAGS="-L/usr/local/packages"
-TST_LDFLAGS="-lstest -L/usr/lib -L/usr/local/packages"
+TST_LDFLAGS="-lstest -pthread -L/usr/lib -L/usr/local/packages"
 
 # Required dependencies (linked .o files from /usr/local/packages)
 REQUIRES=("sigma.core" "sigma.memory" "sigma.test")
@@ -40,7 +40,7 @@ TST_BUILD_DIR="$BUILD_DIR/test"
 
 # Bundle definitions:
 declare -A PACKAGES=(
-    ["collection"]="sigma.collections | arrays array_base collections list parray farray slotarray indexarray map"
+    ["collection"]="sigma.collections | arrays array_base array_simd collections list parray farray slotarray slotmap concurrent_slotarray indexarray map objectpool sparseset soa_indexarray paged_indexarray"
 )
 
 # Build target definitions:
@@ -26,6 +26,23 @@
  */
 #pragma once
 
+#include <stdint.h>
+
 // forward declaration of the collection structure
 struct sc_collection;
-typedef struct sc_collection *collection;
\ No newline at end of file
+typedef struct sc_collection *collection;
+
+// generational handle: slot index in the low 32 bits, slot generation in the high 32 bits
+typedef uint64_t sc_handle;
+#define SC_HANDLE_NULL ((sc_handle)UINT64_MAX)  // index 0xFFFFFFFF is never a valid slot
+#define SC_HANDLE_INDEX(h) ((size_t)((h) & 0xFFFFFFFFu))
+#define SC_HANDLE_GENERATION(h) ((uint32_t)((h) >> 32))
+#define SC_HANDLE_MAKE(index, generation) \
+    (((sc_handle)(uint32_t)(generation) << 32) | (sc_handle)(uint32_t)(index))
+
+// bucket alignment requests (FArray.new_aligned, PArray.new_aligned)
+#define SC_ALIGN_AUTO 0                            // cache line; huge pages from the threshold up
+#define SC_ALIGN_CACHE_LINE 64                     // every bucket gets at least this
+#define SC_ALIGN_PAGE 4096                         // page-aligned start
+#define SC_ALIGN_HUGE_PAGE ((size_t)2 << 20)       // 2 MiB, mapped and advised for huge pages
+#define SC_HUGE_PAGE_THRESHOLD ((size_t)32 << 20)  // SC_ALIGN_AUTO uses huge pages from here up
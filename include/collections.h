@@ -44,6 +44,7 @@ typedef struct sparse_iterator_s *sparse_iterator;
 struct iterator_s {
     struct sc_collection *coll; /* The collection to iterate over */
     size_t current;             /* Current index */
+    sc_alloc_use_t *use;        /* Allocator the iterator was created with */
 };
 
 /* Public interface for collections operations                */
@@ -99,11 +100,6 @@ typedef struct sc_collections_i {
      * @return Version string
      */
     const char *(*version)(void);
-    /**
-     * @brief Configure the allocator used by Collections operations.
-     * @param use Pointer to sc_alloc_use_t or NULL to restore malloc/free fallback
-     */
-    void (*alloc_use)(sc_alloc_use_t *use);
 } sc_collections_i;
 extern const sc_collections_i Collections;
 
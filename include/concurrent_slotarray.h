@@ -0,0 +1,104 @@
+/*
+ * Sigma Collections
+ * Copyright (c) 2026 David Boarman (BadKraft) and contributors
+ * QuantumOverride [Q|]
+ * ----------------------------------------------
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * ----------------------------------------------
+ * File: concurrent_slotarray.h
+ * Description: Header file for Sigma Collections concurrent slotarray definitions and interfaces
+ *
+ * ConcurrentSlotArray:  A SlotArray that many threads may add to, read from and remove
+ *              from without a lock. Free slot indices live on a lock-free stack whose
+ *              head is tagged with a version counter to defeat ABA; get_at is a plain
+ *              acquire load. Storage grows by appending power-of-two segments, so an
+ *              index never moves and concurrent readers never see a reallocated buffer.
+ */
+#pragma once
+
+#include <sigma.core/allocator.h>
+#include "collection.h"
+
+struct sc_concurrent_slotarray;
+typedef struct sc_concurrent_slotarray *concurrent_slotarray;
+
+// forward declaration for sparse_iterator
+struct sparse_iterator_s;
+typedef struct sparse_iterator_s *sparse_iterator;
+
+/* Public interface for concurrent slotarray operations         */
+/* ============================================================ */
+typedef struct sc_concurrent_slotarray_i {
+    /**
+     * @brief Create a new ConcurrentSlotArray.
+     * @param capacity Size of the first segment (rounded up to a power of two, at least 8).
+     * @return A pointer to the newly created ConcurrentSlotArray, or NULL on failure.
+     */
+    concurrent_slotarray (*new)(usize capacity);
+    /**
+     * @brief Create a new ConcurrentSlotArray whose segments come from the given allocator.
+     * @param use Instance allocator (must be thread-safe), or NULL for the Allocator facade.
+     * @param capacity Size of the first segment (rounded up to a power of two, at least 8).
+     * @return A pointer to the newly created ConcurrentSlotArray, or NULL on failure.
+     */
+    concurrent_slotarray (*new_with)(sc_alloc_use_t *, usize);
+    /**
+     * @brief Dispose of the ConcurrentSlotArray and its segments.
+     * @param csa The ConcurrentSlotArray to dispose.
+     * @note Not thread-safe: no other thread may be using the array.
+     */
+    void (*dispose)(concurrent_slotarray);
+    /**
+     * @brief Store a value in a free slot; thread-safe and lock-free except while a new
+     *        segment is being linked in.
+     * @param csa The ConcurrentSlotArray to add the value to.
+     * @param value The value to add (must not be NULL).
+     * @return The index (handle) where the value was added; otherwise -1.
+     */
+    int (*add)(concurrent_slotarray, object);
+    /**
+     * @brief Read the value at an index with a single acquire load; thread-safe.
+     * @param csa The ConcurrentSlotArray to read from.
+     * @param index The index (handle) to read.
+     * @param out_value Pointer to store the value.
+     * @return 0 on OK; non-zero if the slot is empty or out of range
+     */
+    int (*get_at)(concurrent_slotarray, usize, object *);
+    /**
+     * @brief Empty a slot and push its index on the free stack; thread-safe.
+     * @param csa The ConcurrentSlotArray to remove from.
+     * @param index The index (handle) to remove.
+     * @return 0 on OK; non-zero if the slot was already empty or out of range
+     * @note Exactly one of several racing removes of the same index succeeds.
+     */
+    int (*remove_at)(concurrent_slotarray, usize);
+
+    // Introspection
+    bool (*is_empty_slot)(concurrent_slotarray, usize);  // Check if slot is empty
+    usize (*capacity)(concurrent_slotarray);             // Slots across published segments
+
+    /**
+     * @brief Create a sparse iterator over the array.
+     * @param csa The array to iterate over
+     * @return New sparse iterator, or NULL on failure
+     * @note Weakly consistent: concurrent adds/removes may or may not be observed.
+     */
+    sparse_iterator (*create_iterator)(concurrent_slotarray);
+} sc_concurrent_slotarray_i;
+extern const sc_concurrent_slotarray_i ConcurrentSlotArray;
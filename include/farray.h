@@ -47,6 +47,10 @@
 struct sc_flex_array;
 typedef struct sc_flex_array *farray;
 
+// FArray.map_file flags
+#define FARRAY_MAP_READ 0   // read-only mapping
+#define FARRAY_MAP_WRITE 1  // read-write mapping; stores reach the file on sync or dispose
+
 /* Public interface for array operations                        */
 /* ============================================================ */
 typedef struct sc_farray_i {
@@ -56,6 +60,67 @@ typedef struct sc_farray_i {
      * @param stride Size of each element in the array
      */
     farray (*new)(usize, usize);
+    /**
+     * @brief Create a new array whose allocations all go through the given allocator.
+     * @param use Instance allocator, or NULL for the Allocator facade
+     * @param capacity Initial array capacity
+     * @param stride Size of each element in the array
+     * @return New array, or NULL on failure
+     */
+    farray (*new_with)(sc_alloc_use_t *, usize, usize);
+    /**
+     * @brief Create a new array whose clear is O(1) via per-slot epoch stamps.
+     * @param capacity Initial array capacity
+     * @param stride Size of each element in the array
+     * @return New array, or NULL on failure
+     * @note Clear only bumps the epoch; slots written before it read as zero until set again.
+     */
+    farray (*new_epoch)(usize, usize);
+    /**
+     * @brief Create an epoch-cleared array whose allocations all go through the given allocator.
+     * @param use Instance allocator, or NULL for the Allocator facade
+     * @param capacity Initial array capacity
+     * @param stride Size of each element in the array
+     * @return New array, or NULL on failure
+     */
+    farray (*new_epoch_with)(sc_alloc_use_t *, usize, usize);
+    /**
+     * @brief Create a new array whose bucket starts on the requested boundary.
+     * @param capacity Initial array capacity
+     * @param stride Size of each element in the array
+     * @param alignment SC_ALIGN_AUTO, SC_ALIGN_CACHE_LINE, SC_ALIGN_PAGE, SC_ALIGN_HUGE_PAGE or
+     *        another power of two
+     * @return New array, or NULL on failure
+     * @note Every bucket is at least cache-line aligned. SC_ALIGN_HUGE_PAGE maps the bucket on a
+     *       2 MiB boundary and advises transparent huge pages; SC_ALIGN_AUTO does the same from
+     *       SC_HUGE_PAGE_THRESHOLD bytes up. Growth keeps the request.
+     */
+    farray (*new_aligned)(usize, usize, usize);
+    /**
+     * @brief Map a file written by save_file as the array's bucket.
+     * @param path File to map
+     * @param stride Size of each element; must match the stride recorded in the file
+     * @param flags FARRAY_MAP_READ or FARRAY_MAP_WRITE
+     * @return New array whose capacity is the file's element count, or NULL on failure
+     * @note The mapping is shared: every process mapping the file shares its page-cache pages.
+     *       get/set/iteration work unchanged; set, remove and clear fail on a read-only mapping.
+     *       Capacity is fixed by the file. Writable stores reach the file on sync or dispose.
+     */
+    farray (*map_file)(const char *, usize, int);
+    /**
+     * @brief Write the array to a file in the map_file layout (header, then the elements).
+     * @param arr The array to save
+     * @param path File to create or truncate
+     * @param stride Size of each element in the array
+     * @return 0 on OK; otherwise non-zero
+     */
+    int (*save_file)(farray, const char *, usize);
+    /**
+     * @brief Flush stores on a writable file-backed array to its file (msync).
+     * @param arr The array to sync
+     * @return 0 on OK (including arrays that are not file-backed); otherwise non-zero
+     */
+    int (*sync)(farray);
     /**
      * @brief Initialize an array with the specified capacity.
      * @param arr The array to initialize
@@ -63,6 +128,25 @@ typedef struct sc_farray_i {
      * @param stride Size of each element in the array
      */
     void (*init)(farray *, usize, usize);
+    /**
+     * @brief Change the capacity in place, preserving contents.
+     * @param arr The array to resize
+     * @param new_capacity New capacity in elements (must be non-zero)
+     * @param stride Size of each element in the array
+     * @return 0 on OK; otherwise non-zero (the array is unchanged)
+     * @note Uses realloc (or mremap for huge-page buckets), so growth usually avoids a copy.
+     *       Only the new tail is zeroed; shrinking drops the trailing elements. File-backed
+     *       arrays cannot be resized.
+     */
+    int (*resize)(farray, usize, usize);
+    /**
+     * @brief Ensure capacity for at least min_capacity elements.
+     * @param arr The array to grow
+     * @param min_capacity Required capacity in elements
+     * @param stride Size of each element in the array
+     * @return 0 on OK (including when already large enough); otherwise non-zero
+     */
+    int (*reserve)(farray, usize, usize);
     /**
      * @brief Dispose of the array and free associated resources.
      * @param arr The array to dispose of
@@ -107,6 +191,35 @@ typedef struct sc_farray_i {
      * @return 0 on OK; otherwise non-zero
      */
     int (*remove)(farray, usize, usize);
+    /**
+     * @brief Find the first element equal to value, scanning from index from.
+     * @param arr The array to search
+     * @param stride Size of each element in the array
+     * @param value Pointer to the value to find (stride bytes)
+     * @param from Index to start scanning at
+     * @return Index of the first match; -1 if none or on error
+     * @note 1, 2, 4 and 8-byte strides compare whole vectors at a time (SSE2/AVX2 where
+     *       available). A zeroed value finds the first empty slot.
+     */
+    int (*find)(farray, usize, object, usize);
+    /**
+     * @brief Find the first element equal to any of count values, scanning from index from.
+     * @param arr The array to search
+     * @param stride Size of each element in the array
+     * @param values Pointer to count values packed at stride
+     * @param count Number of values
+     * @param from Index to start scanning at
+     * @return Index of the first match; -1 if none or on error
+     */
+    int (*find_any)(farray, usize, object, usize, usize);
+    /**
+     * @brief Count the elements equal to value.
+     * @param arr The array to scan
+     * @param stride Size of each element in the array
+     * @param value Pointer to the value to count (stride bytes)
+     * @return Number of matching elements (0 on error)
+     */
+    usize (*count_eq)(farray, usize, object);
     /**
      * @brief Create a non-owning collection view of the array.
      * @param arr The array to view
@@ -28,7 +28,9 @@
  *              directly in contiguous memory, allowing element insertion, removal,
  *              and retrieval by index. Supports slot reuse and dynamic growth.
  *              Unlike SlotArray (pointer-based), IndexArray stores values inline
- *              for better cache performance with small structs.
+ *              for better cache performance with small structs. Occupancy is tracked
+ *              in a bitmap beside the values, so any value (including all zeros) can
+ *              be stored and emptiness is a single bit test.
  */
 #pragma once
 
@@ -54,6 +56,15 @@ typedef struct sc_indexarray_i {
      */
     indexarray (*new)(usize capacity, usize stride);
 
+    /**
+     * @brief Create a new IndexArray whose allocations, including growth, use the given allocator.
+     * @param use Instance allocator, or NULL for the Allocator facade.
+     * @param capacity The initial number of slots to allocate.
+     * @param stride The size of each element (struct size).
+     * @return A pointer to the newly created IndexArray, or NULL on failure.
+     */
+    indexarray (*new_with)(sc_alloc_use_t *use, usize capacity, usize stride);
+
     /**
      * @brief Dispose of the IndexArray and free its resources.
      * @param ia The IndexArray to dispose.
@@ -86,13 +97,72 @@ typedef struct sc_indexarray_i {
     int (*remove_at)(indexarray ia, usize index);
 
     /**
-     * @brief Create an IndexArray from a flex array, copying all elements.
+     * @brief Add a value and return a generational (index, generation) handle to its slot.
+     * @param ia The IndexArray to add the value to.
+     * @param value Pointer to the value to add (will be copied).
+     * @return The handle; otherwise SC_HANDLE_NULL.
+     * @note Per-slot generations are allocated on the first call (4 bytes per slot).
+     */
+    sc_handle (*add_handle)(indexarray ia, object value);
+
+    /**
+     * @brief Retrieve the value behind a handle, validated in O(1) by generation compare.
+     * @param ia The IndexArray to retrieve the value from.
+     * @param handle A handle returned by add_handle.
+     * @param out_value Pointer to store the retrieved value (must be at least stride bytes).
+     * @return 0 on OK; non-zero if the handle is stale (slot removed, reused or cleared)
+     */
+    int (*get_handle)(indexarray ia, sc_handle handle, object out_value);
+
+    /**
+     * @brief Remove the value behind a handle; the handle (and any copies) become stale.
+     * @param ia The IndexArray to remove the element from.
+     * @param handle A handle returned by add_handle.
+     * @return 0 on OK; non-zero if the handle is stale
+     */
+    int (*remove_handle)(indexarray ia, sc_handle handle);
+
+    /**
+     * @brief Add n values in one sweep over free slots; contiguous free runs are filled by one
+     *        copy.
+     * @param ia The IndexArray to add the values to.
+     * @param values n values packed back to back at the array's stride (will be copied).
+     * @param n Number of values to add.
+     * @param handles_out Optional array of n entries receiving a handle per added value.
+     * @return The number of values added (fewer than n only if a view ran out of slots);
+     *         -1 on invalid arguments
+     */
+    int (*add_many)(indexarray ia, const void *values, usize n, sc_handle *handles_out);
+
+    /**
+     * @brief Remove the values behind n handles; the handles become stale.
+     * @param ia The IndexArray to remove the elements from.
+     * @param handles Array of n handles returned by add_handle or add_many.
+     * @param n Number of handles.
+     * @return The number of values removed (stale handles are skipped); -1 on invalid arguments
+     */
+    int (*remove_many)(indexarray ia, const sc_handle *handles, usize n);
+
+    /**
+     * @brief Create an IndexArray from a flex array, packing its non-empty elements to the front.
      * @param arr The flex array to copy from.
      * @param stride The size of each element.
      * @return A new IndexArray with the elements, or NULL on failure.
+     * @note One streaming pass with one memcpy per run of non-empty elements; the only
+     *       allocations are the IndexArray itself (all-zero elements are taken as empty).
      */
     indexarray (*from_farray)(farray arr, usize stride);
 
+    /**
+     * @brief Copy live values, packed in slot order, into a caller-provided buffer.
+     * @param ia The IndexArray to export from.
+     * @param dst Buffer with room for max_count values of the array's stride.
+     * @param max_count Maximum number of values to copy (count() copies everything).
+     * @return The number of values copied.
+     * @note Allocation-free; each contiguous run of live slots is copied with one memcpy.
+     */
+    usize (*export_values)(indexarray ia, void *dst, usize max_count);
+
     /**
      * @brief Create a non-owning IndexArray view from a raw buffer range.
      * @param buffer Pointer to the start of the buffer.
@@ -100,6 +170,7 @@ typedef struct sc_indexarray_i {
      * @param stride The size of each element (struct size).
      * @return A new IndexArray view, or NULL on failure.
      * @note The IndexArray does not own the buffer - caller must manage lifetime.
+     *       A raw buffer carries no bitmap, so all-zero elements are taken as empty.
      */
     indexarray (*from_buffer)(void *buffer, void *end, usize stride);
 
@@ -129,9 +200,59 @@ typedef struct sc_indexarray_i {
     /**
      * @brief Clear all slots in the IndexArray.
      * @param ia The IndexArray to clear.
+     * @note O(capacity / 64): resets the occupancy bitmap and its summary without touching
+     *       owned values. Outstanding handles are retired in O(1). A from_buffer view's buffer
+     *       is also zeroed, which is O(capacity * stride).
      */
     void (*clear)(indexarray ia);
 
+    // Occupancy statistics
+    /**
+     * @brief Get the number of occupied slots in O(1) (tracked on add/remove).
+     * @param ia The IndexArray to query.
+     * @return The number of occupied slots.
+     */
+    usize (*count)(indexarray ia);
+
+    /**
+     * @brief Get count / capacity in O(1).
+     * @param ia The IndexArray to query.
+     * @return The fill ratio in [0, 1].
+     */
+    double (*fill_ratio)(indexarray ia);
+
+    /**
+     * @brief Get the longest run of consecutive empty slots in O(capacity / 64).
+     * @param ia The IndexArray to query.
+     * @return The run length in slots.
+     */
+    usize (*largest_free_run)(indexarray ia);
+
+    /**
+     * @brief Estimate external fragmentation of the empty slots in O(capacity / 64).
+     * @param ia The IndexArray to query.
+     * @return 1 - largest_free_run / empty slots: 0.0 when the empty slots are contiguous (or
+     *         there are none), approaching 1.0 as they scatter.
+     */
+    double (*fragmentation)(indexarray ia);
+
+    /**
+     * @brief Pack live slots to the front, preserving their relative order.
+     * @param ia The IndexArray to compact.
+     * @param remap Optional out: new farray of int (one per old slot) mapping old index to new
+     *              index, or -1 for slots that were empty. Caller disposes with FArray.dispose.
+     * @return The number of live slots; otherwise -1.
+     * @note Generational handles to moved slots become stale; remap raw indices instead.
+     */
+    int (*compact)(indexarray ia, farray *remap);
+
+    /**
+     * @brief Release trailing empty slots (typically after compact).
+     * @param ia The IndexArray to shrink.
+     * @return 0 on OK; non-zero for buffer views or on allocation failure
+     */
+    int (*shrink_to_fit)(indexarray ia);
+
     /**
      * @brief Create a sparse iterator for the indexarray
      * @param ia The indexarray to iterate over
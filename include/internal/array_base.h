@@ -27,6 +27,7 @@
 #pragma once
 
 #include <sigma.core/types.h>
+#include <string.h>
 
 // Unified array structure - both farray and parray can be cast to this
 typedef struct sc_array_base {
@@ -56,6 +57,66 @@ void array_base_clear(sc_array_base *arr, usize element_size, array_element_clea
 usize array_base_compact(sc_array_base *arr, usize element_size, array_element_empty_fn is_empty_fn,
                          array_element_copy_fn copy_fn, array_element_clear_fn clear_fn);
 
+// Stride-specialized kernels: the stride is dispatched once per call, then every element is
+// handled at a compile-time size (1, 2, 4, 8, 16, 32 or 64 bytes); other sizes take a generic path
+#define ARRAY_KERNEL_STRIDES(X) X(1) X(2) X(4) X(8) X(16) X(32) X(64)
+
+// Vectorized kernels (array_simd.c): SSE2/AVX2 chosen at startup from CPU features, with a
+// scalar fallback on every platform
+#define ARRAY_SIMD_SCALAR 0
+#define ARRAY_SIMD_SSE2 1
+#define ARRAY_SIMD_AVX2 2
+int array_simd_supported(void);
+int array_simd_select(int level);
+bool array_simd_is_zero(const void *bytes, usize size);
+void array_simd_zero(void *bytes, usize size);
+usize array_simd_compact(void *bucket, usize count, usize element_size);
+#define ARRAY_SIMD_MAX_NEEDLES 8  // find with more values than this uses the scalar kernel
+usize array_simd_find(const void *bucket, usize count, usize element_size, const void *values,
+                      usize nvalues);
+usize array_simd_count_eq(const void *bucket, usize count, usize element_size, const void *value);
+
+// all-zero test; a constant size folds to one compare (<= 8) or an OR of 8-byte words,
+// larger elements OR whole vectors
+static inline bool array_kernel_is_zero(const void *element, usize size) {
+    if (size > 64) {
+        return array_simd_is_zero(element, size);
+    }
+    const char *bytes = (const char *)element;
+    uint64_t acc = 0;
+    usize i = 0;
+    for (; i + 8 <= size; i += 8) {
+        uint64_t word;
+        memcpy(&word, bytes + i, 8);
+        acc |= word;
+    }
+    for (; i < size; i++) {
+        acc |= (unsigned char)bytes[i];
+    }
+    return acc == 0;
+}
+
+// element copy; common strides become a fixed-size move instead of a memcpy call
+static inline void array_kernel_copy(void *dest, const void *src, usize size) {
+    switch (size) {
+#define ARRAY_KERNEL_COPY_CASE(N) \
+    case N:                       \
+        memcpy(dest, src, N);     \
+        return;
+        ARRAY_KERNEL_STRIDES(ARRAY_KERNEL_COPY_CASE)
+#undef ARRAY_KERNEL_COPY_CASE
+        default:
+            memcpy(dest, src, size);
+    }
+}
+
+// Zero-is-empty array operations built on the kernels (FArray, PArray and derived structures)
+int array_base_store(sc_array_base *arr, usize element_size, usize index, const void *value);
+int array_base_load(sc_array_base *arr, usize element_size, usize index, void *out_value);
+int array_base_zero_element(sc_array_base *arr, usize element_size, usize index);
+void array_base_zero(sc_array_base *arr);
+usize array_base_compact_zero(sc_array_base *arr, usize element_size);
+
 // Type-specific callback implementations
 // Flex array callbacks (value semantics)
 bool farray_element_is_empty(const void *element, usize element_size);
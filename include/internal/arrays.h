@@ -26,6 +26,7 @@
  */
 #pragma once
 
+#include <sigma.core/allocator.h>
 #include <sigma.core/types.h>
 #include "collection.h"
 #include "farray.h"
@@ -35,10 +36,63 @@
 usize farray_compact(farray arr, usize stride);
 usize parray_compact(parray arr);
 
+// Per-instance allocator dispatch (NULL use = Allocator facade)
+object coll_alloc(sc_alloc_use_t *use, usize size);
+void coll_free(sc_alloc_use_t *use, object ptr);
+object coll_realloc(sc_alloc_use_t *use, object ptr, usize old_size, usize size);
+
 // Common memory management helpers
-object array_alloc_bucket(size_t element_size, usize capacity);
-void array_free_resources(void *bucket, void *struct_ptr);
-void *array_alloc_struct_with_bucket(usize struct_size, char handle_char, usize element_size,
-                                     usize capacity, void **bucket_out, char **end_out);
+// Buckets start on at least a cache line; a hidden header in front of each records how it was
+// obtained, so buckets must only be released and resized through the array_*_bucket helpers.
+object array_alloc_bucket(sc_alloc_use_t *use, size_t element_size, usize capacity);
+object array_alloc_bucket_aligned(sc_alloc_use_t *use, usize element_size, usize capacity,
+                                  usize alignment);
+object array_realloc_bucket(sc_alloc_use_t *use, object bucket, usize old_size, usize size);
+void array_free_bucket(sc_alloc_use_t *use, object bucket);
+usize array_bucket_alignment(const void *bucket);  // requested alignment (SC_ALIGN_*)
+bool array_bucket_is_mapped(const void *bucket);    // huge-page mapping rather than heap
+void array_free_resources(sc_alloc_use_t *use, void *bucket, void *struct_ptr);
+// File mappings (MAP_SHARED: pages are shared with every process mapping the same file)
+void *array_map_file(const char *path, bool writable, usize *length_out);
+int array_sync_mapping(void *mapping, usize length);
+void array_unmap(void *mapping, usize length);
+void *array_alloc_struct_with_bucket(sc_alloc_use_t *use, usize struct_size, char handle_char,
+                                     usize element_size, usize capacity, usize alignment,
+                                     void **bucket_out, char **end_out);
+
+// Epoch shadow helpers (generation-tagged O(1) clear)
+// A slot is live only while its stamp equals the owner's current epoch; epoch 0 is never current.
+uint32_t *array_alloc_epochs(sc_alloc_use_t *use, usize capacity);
+int array_resize_epochs(sc_alloc_use_t *use, uint32_t **epochs, usize old_capacity,
+                        usize new_capacity);
+int array_check_generation(const uint32_t *generations, uint32_t clear_generation, usize capacity,
+                           sc_handle handle);
+void array_advance_epoch(uint32_t *epochs, usize capacity, uint32_t *epoch);
+
+// Occupancy bitmap helpers: bit i of word i / 64 is set while slot i is live
+#define BITMAP_WORDS(capacity) (((capacity) + 63) / 64)
+#define BITMAP_TEST(bits, i) (((bits)[(i) >> 6] >> ((i) & 63)) & 1u)
+#define BITMAP_SET(bits, i) ((bits)[(i) >> 6] |= (uint64_t)1 << ((i) & 63))
+#define BITMAP_CLEAR(bits, i) ((bits)[(i) >> 6] &= ~((uint64_t)1 << ((i) & 63)))
+uint64_t *array_alloc_bitmap(sc_alloc_use_t *use, usize capacity);
+int array_resize_bitmap(sc_alloc_use_t *use, uint64_t **bits, usize old_capacity,
+                        usize new_capacity);
+void array_bitmap_reset(uint64_t *bits, usize capacity);
+void array_bitmap_set_range(uint64_t *bits, usize from, usize count);
+usize array_bitmap_count(const uint64_t *bits, usize capacity);
+usize array_bitmap_next_clear(const uint64_t *bits, usize capacity, usize from);
+usize array_bitmap_largest_free_run(const uint64_t *bits, usize capacity);
+double array_bitmap_fragmentation(const uint64_t *bits, usize capacity, usize live);
+
+// Free-slot summary over an occupancy bitmap: level-1 bit w is set while bitmap word w is full,
+// level-2 bit v while level-1 word v is full; next_clear skips 4096 full slots per level-2 test
+uint64_t *array_alloc_bitmap_summary(sc_alloc_use_t *use, usize capacity);
+int array_resize_bitmap_summary(sc_alloc_use_t *use, uint64_t **summary, const uint64_t *bits,
+                                usize new_capacity);
+void array_bitmap_summary_rebuild(uint64_t *summary, const uint64_t *bits, usize capacity);
+void array_bitmap_summary_update(uint64_t *summary, const uint64_t *bits, usize capacity,
+                                 usize from, usize count);
+usize array_bitmap_summary_next_clear(const uint64_t *summary, const uint64_t *bits,
+                                      usize capacity, usize from);
 
 // Common collection interface helpers
\ No newline at end of file
@@ -26,6 +26,7 @@
  */
 #pragma once
 
+#include <sigma.core/allocator.h>
 #include "internal/array_base.h"
 
 // forward declarations
@@ -42,18 +43,29 @@ struct sc_collection {
     usize stride;
     usize length;
     bool owns_buffer;
+    bool headed_bucket;   // bucket came from array_alloc_bucket (raw view buffers do not)
+    bool read_only;       // view of a read-only mapping: add, remove and clear refuse
+    sc_alloc_use_t *use;  // instance allocator (NULL = Allocator facade)
 };
 
 // array internal functions
-addr array_get_bucket_start(parray arr);
-addr array_get_bucket_end(parray arr);
-addr *array_get_bucket(parray arr);
+addr parray_get_bucket_start(parray arr);
+addr parray_get_bucket_end(parray arr);
+addr *parray_get_bucket(parray arr);
+uint32_t parray_get_version(parray arr);
+int parray_resize_bucket(parray arr, usize new_capacity);
+void *farray_get_bucket(farray arr);
+int farray_resize_bucket(farray arr, usize stride, usize new_capacity);
+void farray_epoch_sync(farray arr, usize stride);
 
 // collection internal functions
-collection collection_new(usize capacity, usize stride);
+collection collection_new(sc_alloc_use_t *use, usize capacity, usize stride);
+collection collection_create_view_with(sc_alloc_use_t *use, void *array, usize stride,
+                                       usize length, bool owns_buffer);
 void collection_dispose(collection coll);
 int collection_add(collection coll, object ptr);
 int collection_grow(collection coll);
+int collection_resize(collection coll, usize new_capacity);
 void collection_clear(collection coll);
 void collection_set_data(collection coll, void *data, usize count);
 
@@ -69,7 +81,7 @@ collection array_create_collection_view(void *buffer, void *end, usize stride, u
                                         bool owns_buffer);
 
 // slotarray internal functions
-slotarray slotarray_create_view(parray arr);
+slotarray slotarray_create_view(sc_alloc_use_t *use, parray arr);
 
 // sparse collection interface (internal)
 typedef struct sc_sparse_i {
@@ -79,4 +91,5 @@ typedef struct sc_sparse_i {
 } sc_sparse_i;
 
 // sparse iterator internal functions
-sparse_iterator sparse_iterator_new(object sparse_coll, const sc_sparse_i *ops);
\ No newline at end of file
+sparse_iterator sparse_iterator_new(sc_alloc_use_t *use, object sparse_coll,
+                                    const sc_sparse_i *ops);
\ No newline at end of file
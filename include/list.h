@@ -46,6 +46,13 @@ typedef struct sc_list_i {
      * @param stride Size of each element in the list
      */
     list (*new)(usize, usize);
+    /**
+     * @brief Create a new list whose allocations, including growth, use the given allocator.
+     * @param use Instance allocator, or NULL for the Allocator facade
+     * @param capacity Initial list capacity
+     * @param stride Size of each element in the list
+     */
+    list (*new_with)(sc_alloc_use_t *, usize, usize);
     /**
      * @brief Dispose of the list and free associated resources.
      * @param lst The list to dispose of
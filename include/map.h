@@ -69,6 +69,22 @@ typedef struct sc_map_i {
      */
     map (*new)(usize capacity);
 
+    /**
+     * @brief Create a new map bound to a specific allocator
+     * @param use Instance allocator (alloc / release / resize); NULL uses the Allocator facade
+     * @param capacity Initial bucket count hint (rounded up to power of 2)
+     * @return New map or NULL on allocation failure
+     *
+     * Every internal allocation — the map itself, its buckets, rehash tables and
+     * iterators — goes through `use`.
+     *
+     * Example:
+     * @code
+     * map hot = Map.new_with(&numa_local_pool, 1024);
+     * @endcode
+     */
+    map (*new_with)(sc_alloc_use_t *use, usize capacity);
+
     /**
      * @brief Initialize an already-allocated map slot
      * @param m Pointer to map slot to initialize
@@ -0,0 +1,117 @@
+/*
+ * Sigma Collections
+ * Copyright (c) 2026 David Boarman (BadKraft) and contributors
+ * QuantumOverride [Q|]
+ * ----------------------------------------------
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * ----------------------------------------------
+ * File: objectpool.h
+ * Description: Header file for Sigma Collections objectpool definitions and interfaces
+ *
+ * ObjectPool:  Fixed-size object blocks carved out of large slabs. Vacant blocks form
+ *              an intrusive free list per slab, so acquire/release are O(1) with no
+ *              per-object allocation. Slabs are tracked in a SlotArray; a slab whose
+ *              objects have all been released can optionally be returned to the
+ *              allocator. Live objects can be iterated with a sparse iterator.
+ */
+#pragma once
+
+#include <sigma.core/allocator.h>
+#include "collection.h"
+
+struct sc_objectpool;
+typedef struct sc_objectpool *objectpool;
+
+// forward declaration for sparse_iterator
+struct sparse_iterator_s;
+typedef struct sparse_iterator_s *sparse_iterator;
+
+/* Public interface for objectpool operations                   */
+/* ============================================================ */
+typedef struct sc_objectpool_i {
+    /**
+     * @brief Create a new ObjectPool.
+     * @param object_size Size of each object in bytes.
+     * @param per_slab Number of objects carved from each slab (0 selects a default of 64).
+     * @return A pointer to the newly created ObjectPool, or NULL on failure.
+     * @note No slab is allocated until the first acquire.
+     */
+    objectpool (*new)(usize object_size, usize per_slab);
+
+    /**
+     * @brief Create a new ObjectPool whose slabs come from the given allocator.
+     * @param use Instance allocator, or NULL for the Allocator facade.
+     * @param object_size Size of each object in bytes.
+     * @param per_slab Number of objects carved from each slab (0 selects a default of 64).
+     * @return A pointer to the newly created ObjectPool, or NULL on failure.
+     */
+    objectpool (*new_with)(sc_alloc_use_t *use, usize object_size, usize per_slab);
+
+    /**
+     * @brief Dispose of the ObjectPool and every slab; outstanding objects become invalid.
+     * @param pool The ObjectPool to dispose.
+     */
+    void (*dispose)(objectpool pool);
+
+    /**
+     * @brief Take a zeroed object from the pool, allocating a new slab only when all are full.
+     * @param pool The ObjectPool to acquire from.
+     * @return Pointer to the object (16-byte aligned within its slab), or NULL on failure.
+     */
+    object (*acquire)(objectpool pool);
+
+    /**
+     * @brief Return an object to its slab's free list.
+     * @param pool The ObjectPool the object was acquired from.
+     * @param obj The object to release.
+     * @return 0 on OK; non-zero for NULL or an object that is not currently acquired
+     * @note O(log slabs): obj is looked up among this pool's live slabs before anything is read
+     *       through it, so double, foreign and released-slab pointers are rejected safely.
+     */
+    int (*release)(objectpool pool, object obj);
+
+    /**
+     * @brief Return slabs to the allocator as soon as their last object is released.
+     * @param pool The ObjectPool to configure.
+     * @param enabled true to release empty slabs (one slab is always kept), false to retain them.
+     */
+    void (*set_release_empty)(objectpool pool, bool enabled);
+
+    /**
+     * @brief Release every slab that currently holds no live objects.
+     * @param pool The ObjectPool to trim.
+     * @return The number of slabs released.
+     */
+    usize (*trim)(objectpool pool);
+
+    // Introspection
+    usize (*count)(objectpool pool);       // Live objects
+    usize (*capacity)(objectpool pool);    // Objects across allocated slabs
+    usize (*slab_count)(objectpool pool);  // Allocated slabs
+
+    /**
+     * @brief Create a sparse iterator over live objects.
+     * @param pool The objectpool to iterate over
+     * @return New sparse iterator, or NULL on failure
+     * @note current_value yields the object pointer.
+     */
+    sparse_iterator (*create_iterator)(objectpool pool);
+} sc_objectpool_i;
+
+extern const sc_objectpool_i ObjectPool;
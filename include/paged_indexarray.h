@@ -0,0 +1,140 @@
+/*
+ * Sigma Collections
+ * Copyright (c) 2026 David Boarman (BadKraft) and contributors
+ * QuantumOverride [Q|]
+ * ----------------------------------------------
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * ----------------------------------------------
+ * File: paged_indexarray.h
+ * Description: Header file for Sigma Collections paged indexarray definitions and interfaces
+ *
+ * PagedIndexArray: IndexArray semantics over fixed-size pages held in a page
+ *              directory. Slot i lives on page i / per_page, so growth only adds a
+ *              page: nothing is copied and element addresses stay valid for as long
+ *              as the element is live. Pages whose slots are all empty can be handed
+ *              back to the allocator; their index range stays reserved.
+ */
+#pragma once
+
+#include <sigma.core/allocator.h>
+#include "collection.h"
+
+#define PAGED_DEFAULT_PAGE_BYTES 65536  // 64 KiB pages
+
+struct sc_paged_indexarray;
+typedef struct sc_paged_indexarray *paged_indexarray;
+
+// forward declaration for sparse_iterator
+struct sparse_iterator_s;
+typedef struct sparse_iterator_s *sparse_iterator;
+
+/* Public interface for paged_indexarray operations             */
+/* ============================================================ */
+typedef struct sc_paged_indexarray_i {
+    /**
+     * @brief Create a new PagedIndexArray.
+     * @param stride The size of each element (struct size).
+     * @param page_bytes Target page size in bytes (0 selects PAGED_DEFAULT_PAGE_BYTES).
+     * @return A pointer to the newly created PagedIndexArray, or NULL on failure.
+     * @note Slots per page is the largest power of two that fits page_bytes (at least 1).
+     *       No page is allocated until the first add.
+     */
+    paged_indexarray (*new)(usize stride, usize page_bytes);
+
+    /**
+     * @brief Create a new PagedIndexArray whose pages come from the given allocator.
+     * @param use Instance allocator, or NULL for the Allocator facade.
+     * @param stride The size of each element (struct size).
+     * @param page_bytes Target page size in bytes (0 selects PAGED_DEFAULT_PAGE_BYTES).
+     * @return A pointer to the newly created PagedIndexArray, or NULL on failure.
+     */
+    paged_indexarray (*new_with)(sc_alloc_use_t *use, usize stride, usize page_bytes);
+
+    /**
+     * @brief Dispose of the PagedIndexArray and every page.
+     * @param pa The PagedIndexArray to dispose.
+     */
+    void (*dispose)(paged_indexarray pa);
+
+    /**
+     * @brief Copy a value into the lowest free slot, adding a page only when all are full.
+     * @param pa The PagedIndexArray to add the value to.
+     * @param value Pointer to the value to add (will be copied; any value is legal).
+     * @return The slot index; otherwise -1.
+     */
+    int (*add)(paged_indexarray pa, object value);
+
+    /**
+     * @brief Copy out the value at a slot.
+     * @param pa The PagedIndexArray to read from.
+     * @param index The slot index.
+     * @param out_value Pointer to store the value (must be at least stride bytes).
+     * @return 0 on OK; non-zero if the slot is empty or out of range
+     */
+    int (*get_at)(paged_indexarray pa, usize index, object out_value);
+
+    /**
+     * @brief Stable pointer to the value at a slot.
+     * @param pa The PagedIndexArray to read from.
+     * @param index The slot index.
+     * @return Pointer valid until the slot is removed (growth never moves it); NULL if empty.
+     */
+    object (*get_ptr)(paged_indexarray pa, usize index);
+
+    /**
+     * @brief Remove the value at a slot.
+     * @param pa The PagedIndexArray to remove from.
+     * @param index The slot index.
+     * @return 0 on OK; non-zero if out of range
+     */
+    int (*remove_at)(paged_indexarray pa, usize index);
+
+    /**
+     * @brief Return pages to the allocator as soon as their last value is removed.
+     * @param pa The PagedIndexArray to configure.
+     * @param enabled true to release empty pages, false to retain them (default).
+     */
+    void (*set_release_empty)(paged_indexarray pa, bool enabled);
+
+    /**
+     * @brief Release every allocated page that holds no live values.
+     * @param pa The PagedIndexArray to trim.
+     * @return The number of pages released.
+     */
+    usize (*trim)(paged_indexarray pa);
+
+    // Introspection
+    bool (*is_empty_slot)(paged_indexarray pa, usize index);  // Check if slot is empty
+    usize (*capacity)(paged_indexarray pa);    // Slots spanned by the page directory
+    usize (*count)(paged_indexarray pa);       // Occupied slots, O(1)
+    usize (*page_count)(paged_indexarray pa);  // Pages currently allocated
+    usize (*per_page)(paged_indexarray pa);    // Slots per page
+    usize (*stride)(paged_indexarray pa);      // Element size
+    void (*clear)(paged_indexarray pa);        // Empty every slot; pages are retained
+
+    /**
+     * @brief Create a sparse iterator over occupied slots.
+     * @param pa The paged_indexarray to iterate over
+     * @return New sparse iterator, or NULL on failure
+     * @note current_value copies the value into the caller's buffer.
+     */
+    sparse_iterator (*create_iterator)(paged_indexarray pa);
+} sc_paged_indexarray_i;
+
+extern const sc_paged_indexarray_i PagedIndexArray;
@@ -59,12 +59,44 @@ typedef struct sc_parray_i {
      * @param capacity Initial array capacity
      */
     parray (*new)(usize);
+    /**
+     * @brief Create a new array whose allocations all go through the given allocator.
+     * @param use Instance allocator, or NULL for the Allocator facade
+     * @param capacity Initial array capacity
+     * @return New array, or NULL on failure
+     */
+    parray (*new_with)(sc_alloc_use_t *, usize);
+    /**
+     * @brief Create a new array whose bucket starts on the requested boundary.
+     * @param capacity Initial array capacity
+     * @param alignment SC_ALIGN_AUTO, SC_ALIGN_CACHE_LINE, SC_ALIGN_PAGE, SC_ALIGN_HUGE_PAGE or
+     *        another power of two
+     * @return New array, or NULL on failure
+     * @note See FArray.new_aligned.
+     */
+    parray (*new_aligned)(usize, usize);
     /**
      * @brief Initialize an array with the specified capacity.
      * @param arr The array to initialize
      * @param capacity Initial array capacity
      */
     void (*init)(parray *, usize);
+    /**
+     * @brief Change the capacity in place, preserving contents.
+     * @param arr The array to resize
+     * @param new_capacity New capacity in elements (must be non-zero)
+     * @return 0 on OK; otherwise non-zero (the array is unchanged)
+     * @note Growth reallocates without an element-by-element copy and only the new tail is
+     *       cleared to ADDR_EMPTY; shrinking drops the trailing elements.
+     */
+    int (*resize)(parray, usize);
+    /**
+     * @brief Ensure capacity for at least min_capacity elements.
+     * @param arr The array to grow
+     * @param min_capacity Required capacity in elements
+     * @return 0 on OK (including when already large enough); otherwise non-zero
+     */
+    int (*reserve)(parray, usize);
     /**
      * @brief Dispose of the array and free associated resources.
      * @param arr The array to dispose of
@@ -104,6 +136,23 @@ typedef struct sc_parray_i {
      * @return 0 on OK; otherwise non-zero
      */
     int (*remove)(parray, usize);
+    /**
+     * @brief Find the first slot holding value.
+     * @param arr The array to search
+     * @param value Address to find (ADDR_EMPTY finds the first empty slot)
+     * @return Index of the first match; -1 if none or on error
+     * @note Compares whole vectors of slots at a time (SSE2/AVX2 where available).
+     */
+    int (*index_of)(parray, addr);
+    /**
+     * @brief Find the first slot holding any of count addresses, scanning from index from.
+     * @param arr The array to search
+     * @param values Addresses to find
+     * @param count Number of addresses
+     * @param from Index to start scanning at
+     * @return Index of the first match; -1 if none or on error
+     */
+    int (*find_any)(parray, const addr *, usize, usize);
     /**
      * @brief Create a non-owning collection view of the array.
      * @param arr The array to view
@@ -120,6 +169,8 @@ typedef struct sc_parray_i {
      * @brief Create a slotarray view of the parray.
      * @param arr The parray to view
      * @return A slotarray view, or NULL on failure
+     * @note A full view rescans the parray only after PArray itself emptied or resized a slot;
+     *       stores through sc_fast.h are not seen.
      */
     slotarray (*as_slotarray)(parray);
 } sc_parray_i;
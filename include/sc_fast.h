@@ -0,0 +1,131 @@
+/*
+ * Sigma Collections
+ * Copyright (c) 2026 David Boarman (BadKraft) and contributors
+ * QuantumOverride [Q|]
+ * ----------------------------------------------
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * ----------------------------------------------
+ * File: sc_fast.h
+ * Description: Unchecked static inline accessors for FArray and PArray hot loops
+ *
+ * Fast access: FArray.get/set and PArray.get/set validate the handle and the index and
+ *              copy through the stride kernels on every call. The accessors here compile
+ *              to a single address computation so tight loops inline and vectorize. They
+ *              do no bounds, epoch or read-only checks: the caller guarantees the index is
+ *              below capacity. Builds without NDEBUG still assert the bounds.
+ *
+ *              Not for FArray.new_epoch arrays (stale slots are not hidden) and stores
+ *              into a FARRAY_MAP_READ array fault. A resize invalidates any pointer taken.
+ */
+#pragma once
+
+#include <assert.h>
+#include <sigma.core/types.h>
+#include "farray.h"
+#include "parray.h"
+
+// leading layout shared by struct sc_flex_array and struct sc_pointer_array; farray.c and
+// parray.c assert that both still match it
+typedef struct sc_fast_head {
+    char handle[2];  // {'F', '\0'} or {'P', '\0'}
+    void *bucket;    // first element
+    void *end;       // one past allocated memory
+} sc_fast_head;
+
+#define SC_FAST_HEAD(arr) ((const sc_fast_head *)(const void *)(arr))
+
+/**
+ * @brief Get the first element of the array's storage.
+ * @param arr The array
+ * @return Pointer to element 0
+ */
+static inline void *farray_data(farray arr) {
+    assert(arr != NULL);
+    return SC_FAST_HEAD(arr)->bucket;
+}
+
+/**
+ * @brief Get the capacity without the interface call.
+ * @param arr The array
+ * @param stride Size of each element in the array
+ * @return Capacity in elements
+ */
+static inline usize farray_capacity_unchecked(farray arr, usize stride) {
+    assert(arr != NULL && stride != 0);
+    const sc_fast_head *head = SC_FAST_HEAD(arr);
+    return (usize)((char *)head->end - (char *)head->bucket) / stride;
+}
+
+/**
+ * @brief Address of the element at index, without validation.
+ * @param arr The array
+ * @param index Element index; must be below capacity
+ * @param stride Size of each element in the array
+ * @return Pointer to the element
+ */
+static inline void *farray_ptr_unchecked(farray arr, usize index, usize stride) {
+    assert(index < farray_capacity_unchecked(arr, stride));
+    return (char *)SC_FAST_HEAD(arr)->bucket + index * stride;
+}
+
+// typed element lvalue: FARRAY_AT(arr, int, i) = 42;
+#define FARRAY_AT(arr, type, index) (*(type *)farray_ptr_unchecked((arr), (index), sizeof(type)))
+
+/**
+ * @brief Get the first slot of the array's storage.
+ * @param arr The array
+ * @return Pointer to slot 0
+ */
+static inline addr *parray_data(parray arr) {
+    assert(arr != NULL);
+    return (addr *)SC_FAST_HEAD(arr)->bucket;
+}
+
+/**
+ * @brief Get the capacity without the interface call.
+ * @param arr The array
+ * @return Capacity in slots
+ */
+static inline usize parray_capacity_unchecked(parray arr) {
+    assert(arr != NULL);
+    const sc_fast_head *head = SC_FAST_HEAD(arr);
+    return (usize)((addr *)head->end - (addr *)head->bucket);
+}
+
+/**
+ * @brief Read the slot at index, without validation.
+ * @param arr The array
+ * @param index Slot index; must be below capacity
+ * @return The stored address (ADDR_EMPTY if the slot is empty)
+ */
+static inline addr parray_load(parray arr, usize index) {
+    assert(index < parray_capacity_unchecked(arr));
+    return parray_data(arr)[index];
+}
+
+/**
+ * @brief Write the slot at index, without validation.
+ * @param arr The array
+ * @param index Slot index; must be below capacity
+ * @param value Address to store (ADDR_EMPTY clears the slot)
+ */
+static inline void parray_store(parray arr, usize index, addr value) {
+    assert(index < parray_capacity_unchecked(arr));
+    parray_data(arr)[index] = value;
+}
@@ -29,11 +29,12 @@
  *             with support for "slots" that can be reused after removal. SlotArray
  *             does not compact the underlying array on removal, preserving indices
  *             for existing elements, reusing freed slots for new elements. Compaction
- *             can be performed via a dedicated function if desired.
+ *             is explicit via SlotArray.compact, which returns an old->new index map.
  */
 #pragma once
 
 #include <sigma.core/allocator.h>
+#include "collection.h"
 #include "farray.h"
 struct sc_slotarray;
 typedef struct sc_slotarray *slotarray;
@@ -55,6 +56,13 @@ typedef struct sc_slotarray_i {
      * @return A pointer to the newly created SlotArray, or NULL on ERRure.
      */
     slotarray (*new)(usize);
+    /**
+     * @brief Create a new SlotArray whose allocations all go through the given allocator.
+     * @param use Instance allocator, or NULL for the Allocator facade.
+     * @param capacity The initial number of slots to allocate.
+     * @return A pointer to the newly created SlotArray, or NULL on failure.
+     */
+    slotarray (*new_with)(sc_alloc_use_t *, usize);
     /**
      * @brief Dispose of the SlotArray and free its resources.
      * @param sa The SlotArray to dispose.
@@ -62,8 +70,11 @@ typedef struct sc_slotarray_i {
     void (*dispose)(slotarray);
     /**
      * @brief Add a value to the SlotArray, reusing empty slots if available.
+     * @details O(1): the most recently freed slot is popped from a side free stack. When no
+     *          slot is free, an owning SlotArray doubles its capacity (up to the configured
+     *          maximum); existing handles stay valid. Views never grow.
      * @param sa The SlotArray to add the value to.
-     * @param value The value to add.
+     * @param value The value to add (must not be NULL).
      * @return The index (handle) where the value was added; otherwise -1.
      */
     int (*add)(slotarray, object);
@@ -82,6 +93,47 @@ typedef struct sc_slotarray_i {
      * @return 0 on OK; otherwise non-zero
      */
     int (*remove_at)(slotarray, usize);
+    /**
+     * @brief Add a value and return a generational (index, generation) handle to its slot.
+     * @param sa The SlotArray to add the value to.
+     * @param value The value to add (must not be NULL).
+     * @return The handle; otherwise SC_HANDLE_NULL.
+     * @note Per-slot generations are allocated on the first call (4 bytes per slot).
+     */
+    sc_handle (*add_handle)(slotarray, object);
+    /**
+     * @brief Retrieve the value behind a handle, validated in O(1) by generation compare.
+     * @param sa The SlotArray to retrieve the value from.
+     * @param handle A handle returned by add_handle.
+     * @param out_value Pointer to store the retrieved value.
+     * @return 0 on OK; non-zero if the handle is stale (slot removed, reused or cleared)
+     */
+    int (*get_handle)(slotarray, sc_handle, object *);
+    /**
+     * @brief Remove the value behind a handle; the handle (and any copies) become stale.
+     * @param sa The SlotArray to remove the element from.
+     * @param handle A handle returned by add_handle.
+     * @return 0 on OK; non-zero if the handle is stale
+     */
+    int (*remove_handle)(slotarray, sc_handle);
+    /**
+     * @brief Add n values in one pass, reserving room for the whole batch before writing.
+     * @param sa The SlotArray to add the values to.
+     * @param values Array of n values (none may be NULL).
+     * @param n Number of values to add.
+     * @param handles_out Optional array of n entries receiving a handle per added value.
+     * @return The number of values added (fewer than n only if max_capacity was reached);
+     *         -1 on invalid arguments, in which case nothing is added
+     */
+    int (*add_many)(slotarray, const object *, usize, sc_handle *);
+    /**
+     * @brief Remove the values behind n handles; the handles become stale.
+     * @param sa The SlotArray to remove the elements from.
+     * @param handles Array of n handles returned by add_handle or add_many.
+     * @param n Number of handles.
+     * @return The number of values removed (stale handles are skipped); -1 on invalid arguments
+     */
+    int (*remove_many)(slotarray, const sc_handle *, usize);
 
     /**
      * @brief Create a SlotArray from a pointer array, copying all non-empty elements.
@@ -95,6 +147,8 @@ typedef struct sc_slotarray_i {
      * @param arr The value array to copy from.
      * @param stride The size of each element.
      * @return A new SlotArray with the elements, or NULL on failure.
+     * @note All copies share one block owned by the SlotArray: slot pointers stay valid
+     *       until dispose and must not be freed individually.
      */
     slotarray (*from_value_array)(farray, usize);
 
@@ -102,6 +156,40 @@ typedef struct sc_slotarray_i {
     bool (*is_empty_slot)(slotarray, usize);  // Check if slot is empty
     usize (*capacity)(slotarray);             // Total slots
     void (*clear)(slotarray);                 // Reset all
+    /**
+     * @brief Cap automatic growth of an owning SlotArray.
+     * @param sa The SlotArray to configure.
+     * @param max_capacity Maximum number of slots, or 0 for unbounded (the default).
+     * @return 0 on OK; non-zero for views or a maximum below the current capacity
+     */
+    int (*set_max_capacity)(slotarray, usize);
+
+    // Occupancy statistics
+    usize (*count)(slotarray);             // Occupied slots, O(1)
+    double (*fill_ratio)(slotarray);       // count / capacity, O(1)
+    usize (*largest_free_run)(slotarray);  // Longest run of empty slots, O(capacity / 64)
+    /**
+     * @brief Estimate external fragmentation of the free slots, O(capacity / 64).
+     * @param sa The SlotArray to inspect.
+     * @return 1 - largest_free_run / empty slots: 0.0 when the empty slots are contiguous (or
+     *         there are none), approaching 1.0 as they scatter.
+     */
+    double (*fragmentation)(slotarray);
+    /**
+     * @brief Pack live slots to the front, preserving their relative order.
+     * @param sa The SlotArray to compact.
+     * @param remap Optional out: new farray of int (one per old slot) mapping old index to new
+     *              index, or -1 for slots that were empty. Caller disposes with FArray.dispose.
+     * @return The number of live slots; otherwise -1.
+     * @note Generational handles to moved slots become stale; remap raw indices instead.
+     */
+    int (*compact)(slotarray, farray *);
+    /**
+     * @brief Release trailing empty slots of an owning SlotArray (typically after compact).
+     * @param sa The SlotArray to shrink.
+     * @return 0 on OK; non-zero for views or on allocation failure
+     */
+    int (*shrink_to_fit)(slotarray);
 
     /**
      * @brief Create a sparse iterator for the slotarray
@@ -0,0 +1,167 @@
+/*
+ * Sigma Collections
+ * Copyright (c) 2026 David Boarman (BadKraft) and contributors
+ * QuantumOverride [Q|]
+ * ----------------------------------------------
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * ----------------------------------------------
+ * File: slotmap.h
+ * Description: Header file for Sigma Collections slotmap definitions and interfaces
+ *
+ * SlotMap:     A handle-based collection that keeps its values densely packed in an
+ *              FArray. A sparse table maps each handle's index to the value's dense
+ *              position and a reverse table maps dense positions back to indices, so
+ *              removal swaps the last value into the hole. Lookups stay O(1) and
+ *              iteration is a contiguous scan of live values only.
+ */
+#pragma once
+
+#include <sigma.core/allocator.h>
+#include "collection.h"
+#include "farray.h"
+
+struct sc_slotmap;
+typedef struct sc_slotmap *slotmap;
+
+// forward declaration for sparse_iterator
+struct sparse_iterator_s;
+typedef struct sparse_iterator_s *sparse_iterator;
+
+/* Public interface for slotmap operations                      */
+/* ============================================================ */
+typedef struct sc_slotmap_i {
+    /**
+     * @brief Create a new SlotMap with the specified initial capacity and element stride.
+     * @param capacity The initial number of values to allocate for (grows on demand).
+     * @param stride The size of each element (struct size).
+     * @return A pointer to the newly created SlotMap, or NULL on failure.
+     */
+    slotmap (*new)(usize capacity, usize stride);
+
+    /**
+     * @brief Create a new SlotMap whose allocations, including growth, use the given allocator.
+     * @param use Instance allocator, or NULL for the Allocator facade.
+     * @param capacity The initial number of values to allocate for.
+     * @param stride The size of each element (struct size).
+     * @return A pointer to the newly created SlotMap, or NULL on failure.
+     */
+    slotmap (*new_with)(sc_alloc_use_t *use, usize capacity, usize stride);
+
+    /**
+     * @brief Dispose of the SlotMap and free its resources.
+     * @param sm The SlotMap to dispose.
+     */
+    void (*dispose)(slotmap sm);
+
+    /**
+     * @brief Copy a value into the SlotMap, appending it to the dense storage.
+     * @param sm The SlotMap to add the value to.
+     * @param value Pointer to the value to add (stride bytes are copied).
+     * @return A generational handle to the value; otherwise SC_HANDLE_NULL.
+     */
+    sc_handle (*add)(slotmap sm, object value);
+
+    /**
+     * @brief Copy out the value behind a handle.
+     * @param sm The SlotMap to retrieve the value from.
+     * @param handle A handle returned by add.
+     * @param out_value Pointer to store the value (must be at least stride bytes).
+     * @return 0 on OK; non-zero if the handle is stale
+     */
+    int (*get)(slotmap sm, sc_handle handle, object out_value);
+
+    /**
+     * @brief Get a pointer to the value behind a handle in dense storage.
+     * @param sm The SlotMap to query.
+     * @param handle A handle returned by add.
+     * @return Pointer to the value, or NULL if the handle is stale.
+     * @note The pointer is invalidated by the next add (growth) or remove (swap).
+     */
+    object (*get_ptr)(slotmap sm, sc_handle handle);
+
+    /**
+     * @brief Remove the value behind a handle; the last dense value is swapped into its place.
+     * @param sm The SlotMap to remove the value from.
+     * @param handle A handle returned by add.
+     * @return 0 on OK; non-zero if the handle is stale
+     */
+    int (*remove)(slotmap sm, sc_handle handle);
+
+    /**
+     * @brief Check whether a handle refers to a live value.
+     * @param sm The SlotMap to query.
+     * @param handle The handle to check.
+     * @return true if the handle is live, false otherwise.
+     */
+    bool (*contains)(slotmap sm, sc_handle handle);
+
+    // Dense access
+    /**
+     * @brief Get the number of live values.
+     * @param sm The SlotMap to query.
+     * @return The number of values stored densely from values(sm).
+     */
+    usize (*count)(slotmap sm);
+
+    /**
+     * @brief Get the start of the dense value storage.
+     * @param sm The SlotMap to query.
+     * @return Pointer to count(sm) contiguous values of stride bytes each.
+     */
+    object (*values)(slotmap sm);
+
+    /**
+     * @brief Get the handle of the value at a dense position.
+     * @param sm The SlotMap to query.
+     * @param position Dense position in [0, count).
+     * @return The handle; otherwise SC_HANDLE_NULL.
+     */
+    sc_handle (*handle_at)(slotmap sm, usize position);
+
+    // Introspection
+    /**
+     * @brief Get the number of values the SlotMap can hold before growing.
+     * @param sm The SlotMap to query.
+     * @return The capacity.
+     */
+    usize (*capacity)(slotmap sm);
+
+    /**
+     * @brief Get the stride (element size).
+     * @param sm The SlotMap to query.
+     * @return The stride in bytes.
+     */
+    usize (*stride)(slotmap sm);
+
+    /**
+     * @brief Remove every value; all outstanding handles become stale.
+     * @param sm The SlotMap to clear.
+     */
+    void (*clear)(slotmap sm);
+
+    /**
+     * @brief Create an iterator over the dense values (no holes to skip).
+     * @param sm The slotmap to iterate over
+     * @return New sparse iterator, or NULL on failure
+     * @note current_index yields the dense position; use handle_at to recover the handle.
+     */
+    sparse_iterator (*create_iterator)(slotmap sm);
+} sc_slotmap_i;
+
+extern const sc_slotmap_i SlotMap;
@@ -0,0 +1,191 @@
+/*
+ * Sigma Collections
+ * Copyright (c) 2026 David Boarman (BadKraft) and contributors
+ * QuantumOverride [Q|]
+ * ----------------------------------------------
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * ----------------------------------------------
+ * File: soa_indexarray.h
+ * Description: Header file for Sigma Collections structure-of-arrays indexarray
+ *
+ * SoaIndexArray: IndexArray semantics (stable slot indices, slot reuse, growth,
+ *              occupancy bitmap) over a structure-of-arrays layout. A record type is
+ *              described by a list of (offset, size) fields; each field is stored in
+ *              its own 64-byte aligned column, so a kernel that reads one or two
+ *              fields streams only those columns. Whole records are scattered into
+ *              the columns on add/set and gathered back out on get. new_split is
+ *              the two-column case: a hot record prefix and its cold remainder.
+ */
+#pragma once
+
+#include <sigma.core/allocator.h>
+#include <stdint.h>
+#include "collection.h"
+
+#define SOA_COLUMN_ALIGN 64  // every column starts on a cache line
+#define SOA_HOT 0            // hot prefix column of a new_split array
+#define SOA_COLD 1           // cold suffix column of a new_split array
+
+// One field of the record type: where it sits in the record and how many bytes it spans
+typedef struct sc_soa_field {
+    usize offset;  // byte offset within the record (offsetof)
+    usize size;    // field size in bytes (sizeof)
+} sc_soa_field;
+
+struct sc_soa_indexarray;
+typedef struct sc_soa_indexarray *soa_indexarray;
+
+// forward declaration for sparse_iterator
+struct sparse_iterator_s;
+typedef struct sparse_iterator_s *sparse_iterator;
+
+/* Public interface for soa_indexarray operations               */
+/* ============================================================ */
+typedef struct sc_soa_indexarray_i {
+    /**
+     * @brief Create a new SoaIndexArray from a field descriptor list.
+     * @param capacity The initial number of slots to allocate (grows on demand).
+     * @param fields Array of field descriptors (copied); fields must lie within the record.
+     * @param field_count Number of fields (at least 1).
+     * @param record_size Size of the whole record (sizeof), used by gather/scatter.
+     * @return A pointer to the newly created SoaIndexArray, or NULL on failure.
+     */
+    soa_indexarray (*new)(usize capacity, const sc_soa_field *fields, usize field_count,
+                          usize record_size);
+
+    /**
+     * @brief Create a new SoaIndexArray whose allocations, including growth, use the given
+     *        allocator.
+     * @param use Instance allocator, or NULL for the Allocator facade.
+     * @param capacity The initial number of slots to allocate.
+     * @param fields Array of field descriptors (copied).
+     * @param field_count Number of fields (at least 1).
+     * @param record_size Size of the whole record (sizeof).
+     * @return A pointer to the newly created SoaIndexArray, or NULL on failure.
+     */
+    soa_indexarray (*new_with)(sc_alloc_use_t *use, usize capacity, const sc_soa_field *fields,
+                               usize field_count, usize record_size);
+
+    /**
+     * @brief Create a hot/cold split array: the first hot_size bytes of each record live in
+     *        the SOA_HOT column and the remainder in the parallel SOA_COLD column.
+     * @param capacity The initial number of slots to allocate.
+     * @param record_size Size of the whole record (sizeof).
+     * @param hot_size Size of the hot prefix (0 < hot_size < record_size).
+     * @return A pointer to the newly created SoaIndexArray, or NULL on failure.
+     * @note Use field_at(sa, i, SOA_HOT) or column(sa, SOA_HOT) so hot loops touch only hot memory.
+     */
+    soa_indexarray (*new_split)(usize capacity, usize record_size, usize hot_size);
+
+    /**
+     * @brief Create a hot/cold split array whose allocations, including growth, use the given
+     *        allocator.
+     * @param use Instance allocator, or NULL for the Allocator facade.
+     * @param capacity The initial number of slots to allocate.
+     * @param record_size Size of the whole record (sizeof).
+     * @param hot_size Size of the hot prefix (0 < hot_size < record_size).
+     * @return A pointer to the newly created SoaIndexArray, or NULL on failure.
+     */
+    soa_indexarray (*new_split_with)(sc_alloc_use_t *use, usize capacity, usize record_size,
+                                     usize hot_size);
+
+    /**
+     * @brief Dispose of the SoaIndexArray and free its columns.
+     * @param sa The SoaIndexArray to dispose.
+     */
+    void (*dispose)(soa_indexarray sa);
+
+    /**
+     * @brief Scatter a record into a free slot, reusing empty slots or growing if needed.
+     * @param sa The SoaIndexArray to add to.
+     * @param record Pointer to the record (record_size bytes; only described fields are kept).
+     * @return The slot index; otherwise -1.
+     */
+    int (*add)(soa_indexarray sa, const void *record);
+
+    /**
+     * @brief Gather the record at a slot.
+     * @param sa The SoaIndexArray to read from.
+     * @param index The slot index.
+     * @param out_record Record buffer; only the described fields are written.
+     * @return 0 on OK; non-zero if the slot is empty or out of range
+     */
+    int (*get_at)(soa_indexarray sa, usize index, void *out_record);
+
+    /**
+     * @brief Scatter a record over an occupied slot.
+     * @param sa The SoaIndexArray to write to.
+     * @param index The slot index.
+     * @param record Pointer to the record.
+     * @return 0 on OK; non-zero if the slot is empty or out of range
+     */
+    int (*set_at)(soa_indexarray sa, usize index, const void *record);
+
+    /**
+     * @brief Remove the record at a slot; the slot is reused by a later add.
+     * @param sa The SoaIndexArray to remove from.
+     * @param index The slot index.
+     * @return 0 on OK; non-zero if out of range
+     */
+    int (*remove_at)(soa_indexarray sa, usize index);
+
+    /**
+     * @brief Span of one field across every slot, for loops over a single column.
+     * @param sa The SoaIndexArray to read.
+     * @param field Field position in the descriptor list.
+     * @return Column start (SOA_COLUMN_ALIGN aligned) holding capacity() elements of the
+     *         field's size, or NULL for a bad field. Valid until the next growth.
+     * @note Empty slots hold stale or zero bytes; mask with occupancy() or is_empty_slot.
+     */
+    object (*column)(soa_indexarray sa, usize field);
+
+    /**
+     * @brief Pointer to one field of one slot.
+     * @param sa The SoaIndexArray to read.
+     * @param index The slot index.
+     * @param field Field position in the descriptor list.
+     * @return Pointer into the field's column, or NULL if the slot is empty or out of range.
+     */
+    object (*field_at)(soa_indexarray sa, usize index, usize field);
+
+    /**
+     * @brief Occupancy bitmap: bit i of word i / 64 is set while slot i is live.
+     * @param sa The SoaIndexArray to read.
+     * @return (capacity() + 63) / 64 words, valid until the next growth.
+     */
+    const uint64_t *(*occupancy)(soa_indexarray sa);
+
+    // Introspection
+    bool (*is_empty_slot)(soa_indexarray sa, usize index);  // Check if slot is empty
+    usize (*capacity)(soa_indexarray sa);                   // Total slots
+    usize (*count)(soa_indexarray sa);                      // Occupied slots, O(1)
+    usize (*field_count)(soa_indexarray sa);                // Number of columns
+    usize (*record_size)(soa_indexarray sa);                // Gathered record size
+    void (*clear)(soa_indexarray sa);                       // Empty every slot in O(capacity / 64)
+
+    /**
+     * @brief Create a sparse iterator over occupied slots.
+     * @param sa The soa_indexarray to iterate over
+     * @return New sparse iterator, or NULL on failure
+     * @note current_value gathers the record into the caller's buffer.
+     */
+    sparse_iterator (*create_iterator)(soa_indexarray sa);
+} sc_soa_indexarray_i;
+
+extern const sc_soa_indexarray_i SoaIndexArray;
@@ -0,0 +1,175 @@
+/*
+ * Sigma Collections
+ * Copyright (c) 2026 David Boarman (BadKraft) and contributors
+ * QuantumOverride [Q|]
+ * ----------------------------------------------
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * ----------------------------------------------
+ * File: sparseset.h
+ * Description: Header file for Sigma Collections sparseset definitions and interfaces
+ *
+ * SparseSet:   Classic sparse set keyed by caller-chosen 32-bit entity ids. A sparse
+ *              table maps entity id -> dense position; a dense table holds the ids and
+ *              an FArray holds one component per id at the same position. Insert,
+ *              remove and contains are O(1), and the live ids and components are
+ *              contiguous. SparseJoin walks the entities present in several sets,
+ *              driven by the smallest one.
+ */
+#pragma once
+
+#include <sigma.core/allocator.h>
+#include <stdint.h>
+#include "collection.h"
+#include "farray.h"
+
+struct sc_sparseset;
+typedef struct sc_sparseset *sparseset;
+
+struct sc_sparse_join;
+typedef struct sc_sparse_join *sparse_join;
+
+// forward declaration for sparse_iterator
+struct sparse_iterator_s;
+typedef struct sparse_iterator_s *sparse_iterator;
+
+/* Public interface for sparseset operations                    */
+/* ============================================================ */
+typedef struct sc_sparseset_i {
+    /**
+     * @brief Create a new SparseSet with the specified initial capacity and component stride.
+     * @param capacity The initial number of entities to allocate for (grows on demand).
+     * @param stride The size of each component in bytes (0 for a tag set with no components).
+     * @return A pointer to the newly created SparseSet, or NULL on failure.
+     */
+    sparseset (*new)(usize capacity, usize stride);
+
+    /**
+     * @brief Create a new SparseSet whose allocations, including growth, use the given allocator.
+     * @param use Instance allocator, or NULL for the Allocator facade.
+     * @param capacity The initial number of entities to allocate for.
+     * @param stride The size of each component in bytes (0 for a tag set).
+     * @return A pointer to the newly created SparseSet, or NULL on failure.
+     */
+    sparseset (*new_with)(sc_alloc_use_t *use, usize capacity, usize stride);
+
+    /**
+     * @brief Dispose of the SparseSet.
+     * @param ss The SparseSet to dispose.
+     */
+    void (*dispose)(sparseset ss);
+
+    /**
+     * @brief Insert an entity with its component, or overwrite the component if present.
+     * @param ss The SparseSet to insert into.
+     * @param entity Entity id (any value below UINT32_MAX).
+     * @param component Pointer to the component to copy, or NULL for a zeroed component.
+     * @return 0 on OK; otherwise non-zero
+     * @note The sparse table grows to cover the largest id seen, so keep ids compact.
+     */
+    int (*insert)(sparseset ss, uint32_t entity, object component);
+
+    /**
+     * @brief Remove an entity, moving the last dense entry into its position.
+     * @param ss The SparseSet to remove from.
+     * @param entity Entity id.
+     * @return 0 on OK; non-zero if the entity is not present
+     */
+    int (*remove)(sparseset ss, uint32_t entity);
+
+    /**
+     * @brief Check whether an entity is present.
+     * @param ss The SparseSet to check.
+     * @param entity Entity id.
+     * @return true if present; otherwise false
+     */
+    bool (*contains)(sparseset ss, uint32_t entity);
+
+    /**
+     * @brief Copy out an entity's component.
+     * @param ss The SparseSet to read from.
+     * @param entity Entity id.
+     * @param out_value Pointer to store the component (must be at least stride bytes).
+     * @return 0 on OK; non-zero if the entity is not present
+     */
+    int (*get)(sparseset ss, uint32_t entity, object out_value);
+
+    /**
+     * @brief Pointer to an entity's component in dense storage.
+     * @param ss The SparseSet to read from.
+     * @param entity Entity id.
+     * @return Pointer valid until the next insert or remove; NULL if absent or for a tag set.
+     */
+    object (*get_ptr)(sparseset ss, uint32_t entity);
+
+    // Dense access: position i of entities() owns component i of components()
+    usize (*count)(sparseset ss);                      // Entities present
+    const uint32_t *(*entities)(sparseset ss);        // Dense entity ids, count() entries
+    object (*components)(sparseset ss);                // Dense components (NULL for a tag set)
+    usize (*stride)(sparseset ss);                     // Component size in bytes
+    void (*clear)(sparseset ss);                       // Remove every entity in O(count)
+
+    /**
+     * @brief Create a sparse iterator over the dense components.
+     * @param ss The sparseset to iterate over
+     * @return New sparse iterator, or NULL on failure
+     * @note current_value copies the component into the caller's buffer.
+     */
+    sparse_iterator (*create_iterator)(sparseset ss);
+} sc_sparseset_i;
+
+/* Public interface for iterating entities present in several sets */
+/* ============================================================ */
+typedef struct sc_sparse_join_i {
+    /**
+     * @brief Create a join over n sets; the smallest set drives the walk.
+     * @param sets Array of n SparseSets (the array is copied).
+     * @param n Number of sets (at least 1).
+     * @return A new join positioned before the first match, or NULL on failure.
+     */
+    sparse_join (*new)(sparseset *sets, usize n);
+
+    /**
+     * @brief Advance to the next entity present in every set.
+     * @param join The join to advance.
+     * @return true if positioned on a match; false when exhausted
+     * @note Removing the current entity from any joined set does not disturb the walk.
+     */
+    bool (*next)(sparse_join join);
+
+    /**
+     * @brief Entity id at the current position.
+     * @param join The join to read.
+     * @return The entity id, or UINT32_MAX if not positioned on a match.
+     */
+    uint32_t (*entity)(sparse_join join);
+
+    /**
+     * @brief Component of the current entity in one of the joined sets.
+     * @param join The join to read.
+     * @param set Position of the set in the array passed to new.
+     * @return Pointer to the component, or NULL (not positioned, bad index or tag set).
+     */
+    object (*component)(sparse_join join, usize set);
+
+    void (*reset)(sparse_join join);    // Re-pick the smallest set and restart
+    void (*dispose)(sparse_join join);  // Free the join (not the sets)
+} sc_sparse_join_i;
+
+extern const sc_sparseset_i SparseSet;
+extern const sc_sparse_join_i SparseJoin;
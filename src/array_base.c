@@ -137,21 +137,113 @@ usize array_base_compact(sc_array_base *arr, usize element_size, array_element_e
     return write_index;
 }
 
-// Flex array callbacks (value semantics - memcpy/memset)
-bool farray_element_is_empty(const void *element, usize element_size) {
-    const char *bytes = (const char *)element;
-    for (usize i = 0; i < element_size; ++i) {
-        if (bytes[i] != 0) {
-            return false;
+// Store a value through the stride-specialized copy
+int array_base_store(sc_array_base *arr, usize element_size, usize index, const void *value) {
+    if (!value || !array_base_is_valid_index(arr, element_size, index)) {
+        return ERR;
+    }
+    array_kernel_copy((char *)arr->bucket + index * element_size, value, element_size);
+    return OK;
+}
+
+// Load a value through the stride-specialized copy
+int array_base_load(sc_array_base *arr, usize element_size, usize index, void *out_value) {
+    if (!out_value || !array_base_is_valid_index(arr, element_size, index)) {
+        return ERR;
+    }
+    array_kernel_copy(out_value, (char *)arr->bucket + index * element_size, element_size);
+    return OK;
+}
+
+// Zero one element
+int array_base_zero_element(sc_array_base *arr, usize element_size, usize index) {
+    if (!array_base_is_valid_index(arr, element_size, index)) {
+        return ERR;
+    }
+    memset((char *)arr->bucket + index * element_size, 0, element_size);
+    return OK;
+}
+
+// Zero the whole bucket in one pass instead of a clear call per element
+void array_base_zero(sc_array_base *arr) {
+    if (!arr || !arr->bucket) {
+        return;
+    }
+    array_simd_zero(arr->bucket, (usize)((char *)arr->end - (char *)arr->bucket));
+}
+
+// Compact kernels for the wide strides: shift non-zero elements to the front, zeroing the vacated
+// slots (1, 2, 4 and 8-byte strides use the mask-based kernels in array_simd.c)
+#define ARRAY_KERNEL_COMPACT_STRIDES(X) X(16) X(32) X(64)
+#define ARRAY_KERNEL_COMPACT(N)                                            \
+    static usize array_kernel_compact_##N(char *bucket, usize capacity) { \
+        usize write_index = 0;                                             \
+        for (usize read_index = 0; read_index < capacity; ++read_index) {  \
+            char *element = bucket + read_index * N;                       \
+            if (array_kernel_is_zero(element, N)) {                        \
+                continue;                                                  \
+            }                                                              \
+            if (write_index != read_index) {                               \
+                memcpy(bucket + write_index * N, element, N);              \
+                memset(element, 0, N);                                     \
+            }                                                              \
+            ++write_index;                                                 \
+        }                                                                  \
+        return write_index;                                                \
+    }
+ARRAY_KERNEL_COMPACT_STRIDES(ARRAY_KERNEL_COMPACT)
+#undef ARRAY_KERNEL_COMPACT
+
+// Generic compact kernel for strides without a specialization
+static usize array_kernel_compact_generic(char *bucket, usize capacity, usize element_size) {
+    usize write_index = 0;
+    for (usize read_index = 0; read_index < capacity; ++read_index) {
+        char *element = bucket + read_index * element_size;
+        if (array_kernel_is_zero(element, element_size)) {
+            continue;
+        }
+        if (write_index != read_index) {
+            memcpy(bucket + write_index * element_size, element, element_size);
+            memset(element, 0, element_size);
         }
+        ++write_index;
     }
-    return true;
+    return write_index;
+}
+
+// Compact with all-zero as empty; the stride is dispatched once, not per element
+usize array_base_compact_zero(sc_array_base *arr, usize element_size) {
+    if (!arr || !arr->bucket || element_size == 0) {
+        return 0;
+    }
+    usize capacity = array_base_capacity(arr, element_size);
+    switch (element_size) {
+        case 1:
+        case 2:
+        case 4:
+        case 8:
+            // mask-based, vectorized
+            return array_simd_compact(arr->bucket, capacity, element_size);
+#define ARRAY_KERNEL_COMPACT_CASE(N) \
+    case N:                          \
+        return array_kernel_compact_##N(arr->bucket, capacity);
+        ARRAY_KERNEL_COMPACT_STRIDES(ARRAY_KERNEL_COMPACT_CASE)
+#undef ARRAY_KERNEL_COMPACT_CASE
+#undef ARRAY_KERNEL_COMPACT_STRIDES
+        default:
+            return array_kernel_compact_generic(arr->bucket, capacity, element_size);
+    }
+}
+
+// Flex array callbacks (value semantics - memcpy/memset)
+bool farray_element_is_empty(const void *element, usize element_size) {
+    return array_kernel_is_zero(element, element_size);
 }
 
 void farray_element_clear(void *element, usize element_size) { memset(element, 0, element_size); }
 
 void farray_element_copy(void *dest, const void *src, usize element_size) {
-    memcpy(dest, src, element_size);
+    array_kernel_copy(dest, src, element_size);
 }
 
 // Pointer array callbacks (reference semantics - direct assignment)
@@ -0,0 +1,511 @@
+/*
+ * Sigma.Collections
+ * Copyright (c) 2025 David Boarman (BadKraft) and contributors
+ * QuantumOverride [Q|]
+ * ----------------------------------------------
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * ----------------------------------------------
+ * File: array_simd.c
+ * Description: Vectorized array kernels (empty test, compaction, bulk clear, equality scans) with
+ *              runtime dispatch
+ */
+
+#include "internal/array_base.h"
+// ------------------------------
+#include <sigma.core/types.h>
+#include <string.h>
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__) && defined(__SSE2__)
+#include <immintrin.h>
+#define ARRAY_SIMD_X86 1
+#endif
+
+#define ARRAY_SIMD_STREAM_BYTES ((usize)8 << 20)  // clears above this bypass the cache
+
+// one kernel set per instruction-set level
+typedef struct simd_kernels {
+    int level;
+    bool (*is_zero)(const void *bytes, usize size);
+    usize (*compact4)(uint32_t *values, usize count);
+    usize (*compact8)(uint64_t *values, usize count);
+    void (*zero)(void *bytes, usize size);
+    // equality scans for 1, 2, 4 and 8-byte elements (indexed by log2 of the width)
+    usize (*find[4])(const void *bucket, usize count, const void *values, usize nvalues);
+    usize (*count_eq[4])(const void *bucket, usize count, const void *value);
+} simd_kernels;
+
+// Scalar kernels (every platform) ------------------------------------------
+
+// OR 8-byte words, checking once per 64 bytes so a dirty head exits early
+static bool scalar_is_zero(const void *bytes, usize size) {
+    const char *p = bytes;
+    usize i = 0;
+    for (; i + 64 <= size; i += 64) {
+        uint64_t w[8];
+        memcpy(w, p + i, 64);
+        if (w[0] | w[1] | w[2] | w[3] | w[4] | w[5] | w[6] | w[7]) {
+            return false;
+        }
+    }
+    uint64_t acc = 0;
+    for (; i + 8 <= size; i += 8) {
+        uint64_t word;
+        memcpy(&word, p + i, 8);
+        acc |= word;
+    }
+    for (; i < size; i++) {
+        acc |= (unsigned char)p[i];
+    }
+    return acc == 0;
+}
+
+// branchless stream compaction: every element is written, the cursor advances only past survivors
+#define SCALAR_COMPACT(T, NAME)                                             \
+    static usize NAME(T *values, usize count) {                             \
+        usize write_index = 0;                                              \
+        for (usize read_index = 0; read_index < count; ++read_index) {      \
+            T value = values[read_index];                                   \
+            values[write_index] = value;                                    \
+            write_index += value != 0;                                      \
+        }                                                                   \
+        memset(values + write_index, 0, (count - write_index) * sizeof(T)); \
+        return write_index;                                                 \
+    }
+SCALAR_COMPACT(uint8_t, scalar_compact1)
+SCALAR_COMPACT(uint16_t, scalar_compact2)
+SCALAR_COMPACT(uint32_t, scalar_compact4)
+SCALAR_COMPACT(uint64_t, scalar_compact8)
+#undef SCALAR_COMPACT
+
+static void scalar_zero(void *bytes, usize size) { memset(bytes, 0, size); }
+
+// single bytes: memchr for one needle, a 256-entry membership table for several
+static usize scalar_find1(const void *bucket, usize count, const void *values, usize nvalues) {
+    const uint8_t *v = bucket;
+    const uint8_t *needles = values;
+    if (nvalues == 1) {
+        const uint8_t *hit = memchr(v, needles[0], count);
+        return hit ? (usize)(hit - v) : count;
+    }
+    bool wanted[256] = {false};
+    for (usize k = 0; k < nvalues; ++k) {
+        wanted[needles[k]] = true;
+    }
+    for (usize i = 0; i < count; ++i) {
+        if (wanted[v[i]]) {
+            return i;
+        }
+    }
+    return count;
+}
+
+// equality count; branch-free so the compiler may vectorize it
+#define SCALAR_SCAN(T, W)                                                              \
+    static usize scalar_count##W(const void *bucket, usize count, const void *value) { \
+        const T *v = bucket;                                                           \
+        T needle;                                                                      \
+        memcpy(&needle, value, W);                                                     \
+        usize matches = 0;                                                             \
+        for (usize i = 0; i < count; ++i) {                                            \
+            matches += v[i] == needle;                                                 \
+        }                                                                              \
+        return matches;                                                                \
+    }
+SCALAR_SCAN(uint8_t, 1)
+// first element equal to any needle, plus the count for the same width
+#define SCALAR_FIND(T, W)                                                            \
+    static usize scalar_find##W(const void *bucket, usize count, const void *values, \
+                                usize nvalues) {                                     \
+        const T *v = bucket;                                                         \
+        for (usize i = 0; i < count; ++i) {                                          \
+            for (usize k = 0; k < nvalues; ++k) {                                    \
+                T needle;                                                            \
+                memcpy(&needle, (const char *)values + k * W, W);                    \
+                if (v[i] == needle) {                                                \
+                    return i;                                                        \
+                }                                                                    \
+            }                                                                        \
+        }                                                                            \
+        return count;                                                                \
+    }                                                                                \
+    SCALAR_SCAN(T, W)
+SCALAR_FIND(uint16_t, 2)
+SCALAR_FIND(uint32_t, 4)
+SCALAR_FIND(uint64_t, 8)
+#undef SCALAR_FIND
+#undef SCALAR_SCAN
+
+static const simd_kernels scalar_kernels = {
+    ARRAY_SIMD_SCALAR, scalar_is_zero, scalar_compact4, scalar_compact8, scalar_zero,
+    {scalar_find1, scalar_find2, scalar_find4, scalar_find8},
+    {scalar_count1, scalar_count2, scalar_count4, scalar_count8}};
+
+#ifdef ARRAY_SIMD_X86
+// SSE2 kernels (x86 baseline) ----------------------------------------------
+
+// OR four 16-byte vectors per step, one compare per 64 bytes
+static bool sse2_is_zero(const void *bytes, usize size) {
+    const char *p = bytes;
+    usize i = 0;
+    for (; i + 64 <= size; i += 64) {
+        __m128i acc = _mm_or_si128(_mm_or_si128(_mm_loadu_si128((const __m128i *)(p + i)),
+                                                _mm_loadu_si128((const __m128i *)(p + i + 16))),
+                                   _mm_or_si128(_mm_loadu_si128((const __m128i *)(p + i + 32)),
+                                                _mm_loadu_si128((const __m128i *)(p + i + 48))));
+        if (_mm_movemask_epi8(_mm_cmpeq_epi8(acc, _mm_setzero_si128())) != 0xFFFF) {
+            return false;
+        }
+    }
+    return scalar_is_zero(p + i, size - i);
+}
+
+// aligned non-temporal 16-byte stores for clears too large to be worth caching
+static void sse2_zero(void *bytes, usize size) {
+    if (size < ARRAY_SIMD_STREAM_BYTES) {
+        memset(bytes, 0, size);
+        return;
+    }
+    char *p = bytes;
+    usize head = (16 - ((uintptr_t)p & 15)) & 15;
+    memset(p, 0, head);
+    p += head;
+    size -= head;
+    const __m128i zero = _mm_setzero_si128();
+    for (; size >= 64; size -= 64, p += 64) {
+        _mm_stream_si128((__m128i *)p, zero);
+        _mm_stream_si128((__m128i *)(p + 16), zero);
+        _mm_stream_si128((__m128i *)(p + 32), zero);
+        _mm_stream_si128((__m128i *)(p + 48), zero);
+    }
+    _mm_sfence();
+    memset(p, 0, size);
+}
+
+// SSE2 has no 64-bit compare: both 32-bit halves must match
+static inline __m128i sse2_cmpeq_epi64(__m128i a, __m128i b) {
+    __m128i eq = _mm_cmpeq_epi32(a, b);
+    return _mm_and_si128(eq, _mm_shuffle_epi32(eq, _MM_SHUFFLE(2, 3, 0, 1)));
+}
+
+// compare a vector of lanes against each broadcast needle; a matching W-byte lane sets W mask
+// bits, so the first hit is ctz / W and the number of hits is popcount / W. The tail that does
+// not fill a vector goes to the scalar kernel.
+#define VECTOR_SCAN(PREFIX, ATTR, VEC, BYTES, LOADU, SET1, CMPEQ, OR, MOVEMASK, T, W)         \
+    ATTR static usize PREFIX##_find##W(const void *bucket, usize count, const void *values,   \
+                                        usize nvalues) {                                      \
+        const T *v = bucket;                                                                  \
+        VEC splat[ARRAY_SIMD_MAX_NEEDLES];                                                    \
+        for (usize k = 0; k < nvalues; ++k) {                                                 \
+            T needle;                                                                         \
+            memcpy(&needle, (const char *)values + k * W, W);                                 \
+            splat[k] = SET1(needle);                                                          \
+        }                                                                                     \
+        usize i = 0;                                                                          \
+        for (; i + BYTES / W <= count; i += BYTES / W) {                                      \
+            VEC data = LOADU((const VEC *)(v + i));                                           \
+            VEC hit = CMPEQ(data, splat[0]);                                                  \
+            for (usize k = 1; k < nvalues; ++k) {                                             \
+                hit = OR(hit, CMPEQ(data, splat[k]));                                         \
+            }                                                                                 \
+            unsigned mask = (unsigned)MOVEMASK(hit);                                          \
+            if (mask) {                                                                       \
+                return i + (usize)__builtin_ctz(mask) / W;                                    \
+            }                                                                                 \
+        }                                                                                     \
+        return i + scalar_find##W(v + i, count - i, values, nvalues);                         \
+    }                                                                                         \
+    ATTR static usize PREFIX##_count##W(const void *bucket, usize count, const void *value) { \
+        const T *v = bucket;                                                                  \
+        T needle;                                                                             \
+        memcpy(&needle, value, W);                                                            \
+        VEC splat = SET1(needle);                                                             \
+        usize bits = 0;                                                                       \
+        usize i = 0;                                                                          \
+        for (; i + BYTES / W <= count; i += BYTES / W) {                                      \
+            VEC data = LOADU((const VEC *)(v + i));                                           \
+            bits += (usize)__builtin_popcount((unsigned)MOVEMASK(CMPEQ(data, splat)));        \
+        }                                                                                     \
+        return bits / W + scalar_count##W(v + i, count - i, value);                           \
+    }
+
+#define SSE2_SCAN(T, W, SET1, CMPEQ)                                             \
+    VECTOR_SCAN(sse2, , __m128i, 16, _mm_loadu_si128, SET1, CMPEQ, _mm_or_si128, \
+                _mm_movemask_epi8, T, W)
+SSE2_SCAN(uint8_t, 1, _mm_set1_epi8, _mm_cmpeq_epi8)
+SSE2_SCAN(uint16_t, 2, _mm_set1_epi16, _mm_cmpeq_epi16)
+SSE2_SCAN(uint32_t, 4, _mm_set1_epi32, _mm_cmpeq_epi32)
+SSE2_SCAN(uint64_t, 8, _mm_set1_epi64x, sse2_cmpeq_epi64)
+#undef SSE2_SCAN
+
+static const simd_kernels sse2_kernels = {
+    ARRAY_SIMD_SSE2, sse2_is_zero, scalar_compact4, scalar_compact8, sse2_zero,
+    {sse2_find1, sse2_find2, sse2_find4, sse2_find8},
+    {sse2_count1, sse2_count2, sse2_count4, sse2_count8}};
+
+// AVX2 kernels (selected at runtime) ---------------------------------------
+
+// lane permutations that move the kept lanes of an 8 x 32-bit vector to the front:
+// [mask] for 4-byte elements, [mask] with index pairs for 8-byte elements
+static uint32_t compress_perm4[256][8];
+static uint32_t compress_perm8[16][8];
+
+static void avx2_build_tables(void) {
+    for (unsigned mask = 0; mask < 256; mask++) {
+        unsigned k = 0;
+        for (unsigned lane = 0; lane < 8; lane++) {
+            if (mask & (1u << lane)) compress_perm4[mask][k++] = lane;
+        }
+        while (k < 8) compress_perm4[mask][k++] = 0;
+    }
+    for (unsigned mask = 0; mask < 16; mask++) {
+        unsigned k = 0;
+        for (unsigned lane = 0; lane < 4; lane++) {
+            if (mask & (1u << lane)) {
+                compress_perm8[mask][k++] = 2 * lane;
+                compress_perm8[mask][k++] = 2 * lane + 1;
+            }
+        }
+        while (k < 8) compress_perm8[mask][k++] = 0;
+    }
+}
+
+// OR four 32-byte vectors per step, one vptest per 128 bytes
+__attribute__((target("avx2"))) static bool avx2_is_zero(const void *bytes, usize size) {
+    const char *p = bytes;
+    usize i = 0;
+    for (; i + 128 <= size; i += 128) {
+        __m256i acc =
+            _mm256_or_si256(_mm256_or_si256(_mm256_loadu_si256((const __m256i *)(p + i)),
+                                            _mm256_loadu_si256((const __m256i *)(p + i + 32))),
+                            _mm256_or_si256(_mm256_loadu_si256((const __m256i *)(p + i + 64)),
+                                            _mm256_loadu_si256((const __m256i *)(p + i + 96))));
+        if (!_mm256_testz_si256(acc, acc)) {
+            return false;
+        }
+    }
+    return sse2_is_zero(p + i, size - i);
+}
+
+// mask-based stream compaction: compare 8 lanes with zero, permute survivors to the front and
+// store the whole vector at the write cursor (write <= read, so only consumed lanes are clobbered)
+__attribute__((target("avx2"))) static usize avx2_compact4(uint32_t *values, usize count) {
+    const __m256i zero = _mm256_setzero_si256();
+    usize write_index = 0;
+    usize read_index = 0;
+    for (; read_index + 8 <= count; read_index += 8) {
+        __m256i v = _mm256_loadu_si256((const __m256i *)(values + read_index));
+        unsigned empty =
+            (unsigned)_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(v, zero)));
+        unsigned keep = ~empty & 0xFFu;
+        __m256i perm = _mm256_loadu_si256((const __m256i *)compress_perm4[keep]);
+        _mm256_storeu_si256((__m256i *)(values + write_index),
+                            _mm256_permutevar8x32_epi32(v, perm));
+        write_index += (usize)__builtin_popcount(keep);
+    }
+    for (; read_index < count; ++read_index) {
+        uint32_t value = values[read_index];
+        values[write_index] = value;
+        write_index += value != 0;
+    }
+    memset(values + write_index, 0, (count - write_index) * sizeof(uint32_t));
+    return write_index;
+}
+
+__attribute__((target("avx2"))) static usize avx2_compact8(uint64_t *values, usize count) {
+    const __m256i zero = _mm256_setzero_si256();
+    usize write_index = 0;
+    usize read_index = 0;
+    for (; read_index + 4 <= count; read_index += 4) {
+        __m256i v = _mm256_loadu_si256((const __m256i *)(values + read_index));
+        unsigned empty =
+            (unsigned)_mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpeq_epi64(v, zero)));
+        unsigned keep = ~empty & 0xFu;
+        __m256i perm = _mm256_loadu_si256((const __m256i *)compress_perm8[keep]);
+        _mm256_storeu_si256((__m256i *)(values + write_index),
+                            _mm256_permutevar8x32_epi32(v, perm));
+        write_index += (usize)__builtin_popcount(keep);
+    }
+    for (; read_index < count; ++read_index) {
+        uint64_t value = values[read_index];
+        values[write_index] = value;
+        write_index += value != 0;
+    }
+    memset(values + write_index, 0, (count - write_index) * sizeof(uint64_t));
+    return write_index;
+}
+
+// aligned non-temporal 32-byte stores for clears too large to be worth caching
+__attribute__((target("avx2"))) static void avx2_zero(void *bytes, usize size) {
+    if (size < ARRAY_SIMD_STREAM_BYTES) {
+        memset(bytes, 0, size);
+        return;
+    }
+    char *p = bytes;
+    usize head = (32 - ((uintptr_t)p & 31)) & 31;
+    memset(p, 0, head);
+    p += head;
+    size -= head;
+    const __m256i zero = _mm256_setzero_si256();
+    for (; size >= 128; size -= 128, p += 128) {
+        _mm256_stream_si256((__m256i *)p, zero);
+        _mm256_stream_si256((__m256i *)(p + 32), zero);
+        _mm256_stream_si256((__m256i *)(p + 64), zero);
+        _mm256_stream_si256((__m256i *)(p + 96), zero);
+    }
+    _mm_sfence();
+    memset(p, 0, size);
+}
+
+#define AVX2_SCAN(T, W, SET1, CMPEQ)                                                          \
+    VECTOR_SCAN(avx2, __attribute__((target("avx2"))), __m256i, 32, _mm256_loadu_si256, SET1, \
+                CMPEQ, _mm256_or_si256, _mm256_movemask_epi8, T, W)
+AVX2_SCAN(uint8_t, 1, _mm256_set1_epi8, _mm256_cmpeq_epi8)
+AVX2_SCAN(uint16_t, 2, _mm256_set1_epi16, _mm256_cmpeq_epi16)
+AVX2_SCAN(uint32_t, 4, _mm256_set1_epi32, _mm256_cmpeq_epi32)
+AVX2_SCAN(uint64_t, 8, _mm256_set1_epi64x, _mm256_cmpeq_epi64)
+#undef AVX2_SCAN
+#undef VECTOR_SCAN
+
+static const simd_kernels avx2_kernels = {
+    ARRAY_SIMD_AVX2, avx2_is_zero, avx2_compact4, avx2_compact8, avx2_zero,
+    {avx2_find1, avx2_find2, avx2_find4, avx2_find8},
+    {avx2_count1, avx2_count2, avx2_count4, avx2_count8}};
+#endif
+
+// Dispatch -------------------------------------------------------------------
+
+static const simd_kernels *simd_active = &scalar_kernels;
+static int simd_supported = ARRAY_SIMD_SCALAR;
+
+// pick the widest kernel set the CPU supports, once, before main
+__attribute__((constructor)) static void array_simd_init(void) {
+#ifdef ARRAY_SIMD_X86
+    __builtin_cpu_init();
+    simd_supported = ARRAY_SIMD_SSE2;
+    if (__builtin_cpu_supports("avx2")) {
+        avx2_build_tables();
+        simd_supported = ARRAY_SIMD_AVX2;
+    }
+#endif
+    array_simd_select(simd_supported);
+}
+
+// Public kernels -------------------------------------------------------------
+
+// highest level the running CPU supports
+int array_simd_supported(void) { return simd_supported; }
+
+// select a kernel level (clamped to what the CPU supports); returns the level now active
+int array_simd_select(int level) {
+    if (level > simd_supported) {
+        level = simd_supported;
+    }
+#ifdef ARRAY_SIMD_X86
+    if (level >= ARRAY_SIMD_AVX2) {
+        simd_active = &avx2_kernels;
+    } else if (level == ARRAY_SIMD_SSE2) {
+        simd_active = &sse2_kernels;
+    } else {
+        simd_active = &scalar_kernels;
+    }
+#else
+    simd_active = &scalar_kernels;
+#endif
+    return simd_active->level;
+}
+
+// true if size bytes are all zero
+bool array_simd_is_zero(const void *bytes, usize size) { return simd_active->is_zero(bytes, size); }
+
+// zero size bytes; very large spans use non-temporal stores
+void array_simd_zero(void *bytes, usize size) { simd_active->zero(bytes, size); }
+
+// in-place compaction of all-zero (empty) elements for strides 1, 2, 4 and 8; vacated slots are
+// zeroed; returns the survivor count, or count unchanged for other strides
+usize array_simd_compact(void *bucket, usize count, usize element_size) {
+    switch (element_size) {
+        case 1:
+            return scalar_compact1(bucket, count);
+        case 2:
+            return scalar_compact2(bucket, count);
+        case 4:
+            return simd_active->compact4(bucket, count);
+        case 8:
+            return simd_active->compact8(bucket, count);
+        default:
+            return count;
+    }
+}
+
+// kernel slot for the scan widths, or -1 for strides that take the generic path
+static int scan_slot(usize element_size) {
+    switch (element_size) {
+        case 1:
+            return 0;
+        case 2:
+            return 1;
+        case 4:
+            return 2;
+        case 8:
+            return 3;
+        default:
+            return -1;
+    }
+}
+
+// first index in [0, count) whose element equals one of nvalues needles packed at element_size;
+// count if none. Other strides filter on the first byte and confirm with memcmp, as memmem does.
+usize array_simd_find(const void *bucket, usize count, usize element_size, const void *values,
+                      usize nvalues) {
+    if (count == 0 || nvalues == 0) {
+        return count;
+    }
+    int slot = scan_slot(element_size);
+    if (slot >= 0) {
+        const simd_kernels *kernels =
+            nvalues <= ARRAY_SIMD_MAX_NEEDLES ? simd_active : &scalar_kernels;
+        return kernels->find[slot](bucket, count, values, nvalues);
+    }
+    const unsigned char *element = bucket;
+    const unsigned char *needles = values;
+    for (usize i = 0; i < count; ++i, element += element_size) {
+        for (usize k = 0; k < nvalues; ++k) {
+            const unsigned char *needle = needles + k * element_size;
+            if (element[0] == needle[0] && memcmp(element, needle, element_size) == 0) {
+                return i;
+            }
+        }
+    }
+    return count;
+}
+
+// number of elements in [0, count) equal to value
+usize array_simd_count_eq(const void *bucket, usize count, usize element_size, const void *value) {
+    int slot = scan_slot(element_size);
+    if (slot >= 0) {
+        return simd_active->count_eq[slot](bucket, count, value);
+    }
+    const unsigned char *element = bucket;
+    const unsigned char *needle = value;
+    usize matches = 0;
+    for (usize i = 0; i < count; ++i, element += element_size) {
+        matches += element[0] == needle[0] && memcmp(element, needle, element_size) == 0;
+    }
+    return matches;
+}
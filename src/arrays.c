@@ -25,37 +25,302 @@
  * Description: Common array operations implementation
  */
 
+#define _GNU_SOURCE  // MAP_ANONYMOUS, MADV_HUGEPAGE, mremap
+
 #include "internal/arrays.h"
 // ------------------------------
 #include <sigma.core/allocator.h>
 #include <string.h>
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// allocate through the instance allocator, falling back to the Allocator facade
+object coll_alloc(sc_alloc_use_t *use, usize size) {
+    if (use && use->alloc) return use->alloc(size);
+    return Allocator.alloc(size);
+}
+
+// release through the instance allocator, falling back to the Allocator facade
+void coll_free(sc_alloc_use_t *use, object ptr) {
+    if (use && use->release) {
+        use->release(ptr);
+        return;
+    }
+    Allocator.dispose(ptr);
+}
+
+// resize through the instance allocator; hooks without resize get alloc + copy + release
+object coll_realloc(sc_alloc_use_t *use, object ptr, usize old_size, usize size) {
+    if (!use) return Allocator.realloc(ptr, size);
+    if (use->resize) return use->resize(ptr, size);
+
+    object resized = coll_alloc(use, size);
+    if (resized && ptr) {
+        memcpy(resized, ptr, old_size < size ? old_size : size);
+        coll_free(use, ptr);
+    }
+    return resized;
+}
+
+// header stored immediately before every bucket
+typedef struct bucket_header {
+    void *raw;        // start of the underlying allocation or mapping
+    usize mapped;     // mapping length, 0 for heap buckets
+    usize alignment;  // requested alignment (SC_ALIGN_*), reused on resize
+} bucket_header;
+
+#define BUCKET_HEADER(bucket) ((bucket_header *)(bucket) - 1)
+#define ALIGN_UP(value, alignment) (((value) + (alignment) - 1) & ~((uintptr_t)(alignment) - 1))
+
+// Helper: map a bucket on a 2 MiB boundary and advise transparent huge pages; NULL if unsupported
+static object bucket_map_huge(usize size, usize alignment) {
+#if defined(__linux__)
+    usize span = ALIGN_UP(size ? size : 1, SC_ALIGN_HUGE_PAGE);
+    if (span < size || span > SIZE_MAX - SC_ALIGN_HUGE_PAGE) {
+        return NULL;
+    }
+    usize length = span + SC_ALIGN_HUGE_PAGE;  // room for the header and the alignment shift
+    char *raw = mmap(NULL, length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (raw == MAP_FAILED) {
+        return NULL;
+    }
+    char *bucket = (char *)ALIGN_UP((uintptr_t)raw + sizeof(bucket_header), SC_ALIGN_HUGE_PAGE);
+#ifdef MADV_HUGEPAGE
+    madvise(bucket, span, MADV_HUGEPAGE);  // advisory: plain pages still work if refused
+#endif
+    BUCKET_HEADER(bucket)->raw = raw;
+    BUCKET_HEADER(bucket)->mapped = length;
+    BUCKET_HEADER(bucket)->alignment = alignment;
+    return bucket;
+#else
+    (void)size;
+    (void)alignment;
+    return NULL;
+#endif
+}
+
+// Helper: heap bucket over-allocated so its start lands on the alignment boundary
+static object bucket_alloc_heap(sc_alloc_use_t *use, usize size, usize alignment, usize boundary) {
+    if (size > SIZE_MAX - boundary - sizeof(bucket_header)) {
+        return NULL;
+    }
+    char *raw = coll_alloc(use, size + boundary - 1 + sizeof(bucket_header));
+    if (!raw) {
+        return NULL;
+    }
+    char *bucket = (char *)ALIGN_UP((uintptr_t)raw + sizeof(bucket_header), boundary);
+    BUCKET_HEADER(bucket)->raw = raw;
+    BUCKET_HEADER(bucket)->mapped = 0;
+    BUCKET_HEADER(bucket)->alignment = alignment;
+    return bucket;
+}
+
+// Helper: effective boundary for a request; SC_ALIGN_AUTO is a cache line
+static usize bucket_boundary(usize alignment) {
+    return alignment > SC_ALIGN_CACHE_LINE ? alignment : SC_ALIGN_CACHE_LINE;
+}
+
+// Helper: should a bucket of this size and request be a huge-page mapping?
+static bool bucket_wants_huge(sc_alloc_use_t *use, usize size, usize alignment) {
+    if (use) {
+        return false;  // instance allocators supply every byte; huge requests get a 2 MiB boundary
+    }
+    return alignment == SC_ALIGN_HUGE_PAGE ||
+           (alignment == SC_ALIGN_AUTO && size >= SC_HUGE_PAGE_THRESHOLD);
+}
+
+// Helper: allocate size bytes under an alignment request
+static object bucket_alloc(sc_alloc_use_t *use, usize size, usize alignment) {
+    if (alignment & (alignment - 1)) {
+        return NULL;  // not a power of two
+    }
+    if (bucket_wants_huge(use, size, alignment)) {
+        object bucket = bucket_map_huge(size, alignment);
+        if (bucket) {
+            return bucket;
+        }
+        if (alignment == SC_ALIGN_AUTO) {
+            return bucket_alloc_heap(use, size, alignment, SC_ALIGN_PAGE);  // no mmap: page-align
+        }
+    }
+    return bucket_alloc_heap(use, size, alignment, bucket_boundary(alignment));
+}
+
+// allocate memory for an array bucket (cache-line aligned; huge pages above the threshold)
+object array_alloc_bucket(sc_alloc_use_t *use, size_t element_size, usize capacity) {
+    return array_alloc_bucket_aligned(use, element_size, capacity, SC_ALIGN_AUTO);
+}
 
-// allocate memory for an array bucket
-object array_alloc_bucket(size_t element_size, usize capacity) {
+// allocate memory for an array bucket under an SC_ALIGN_* request
+object array_alloc_bucket_aligned(sc_alloc_use_t *use, usize element_size, usize capacity,
+                                  usize alignment) {
     // Check for overflow: capacity * element_size > SIZE_MAX
     if (capacity > 0 && element_size > SIZE_MAX / capacity) {
         return NULL;  // Would overflow
     }
-    return Allocator.alloc(element_size * capacity);
+    return bucket_alloc(use, element_size * capacity, alignment);
+}
+
+// resize a bucket, preserving contents and the alignment request; heap buckets use realloc and
+// shift the data only if the allocator moved it off the boundary
+object array_realloc_bucket(sc_alloc_use_t *use, object bucket, usize old_size, usize size) {
+    if (!bucket) {
+        return array_alloc_bucket_aligned(use, 1, size, SC_ALIGN_AUTO);
+    }
+    bucket_header header = *BUCKET_HEADER(bucket);
+    usize keep = old_size < size ? old_size : size;
+
+    if (header.mapped) {
+        if ((char *)bucket + size <= (char *)header.raw + header.mapped) {
+            return bucket;  // the mapping already covers the new size
+        }
+#if defined(__linux__)
+        // extend the mapping in place: no copy, and the 2 MiB boundary is kept
+        usize offset = (usize)((char *)bucket - (char *)header.raw);
+        usize span = ALIGN_UP(size, SC_ALIGN_HUGE_PAGE);
+        if (span >= size && span <= SIZE_MAX - offset &&
+            mremap(header.raw, header.mapped, offset + span, 0) != MAP_FAILED) {
+#ifdef MADV_HUGEPAGE
+            madvise(bucket, span, MADV_HUGEPAGE);
+#endif
+            BUCKET_HEADER(bucket)->mapped = offset + span;
+            return bucket;
+        }
+#endif
+    } else if (!bucket_wants_huge(use, size, header.alignment)) {
+        usize boundary = bucket_boundary(header.alignment);
+        usize offset = (usize)((char *)bucket - (char *)header.raw);
+        if (size > SIZE_MAX - boundary - sizeof(bucket_header)) {
+            return NULL;
+        }
+        char *raw = coll_realloc(use, header.raw, old_size + offset,
+                                 size + boundary - 1 + sizeof(bucket_header));
+        if (!raw) {
+            return NULL;  // original bucket is left intact
+        }
+        char *resized = (char *)ALIGN_UP((uintptr_t)raw + sizeof(bucket_header), boundary);
+        if (resized != raw + offset) {
+            memmove(resized, raw + offset, keep);
+        }
+        BUCKET_HEADER(resized)->raw = raw;
+        BUCKET_HEADER(resized)->mapped = 0;
+        BUCKET_HEADER(resized)->alignment = header.alignment;
+        return resized;
+    }
+
+    // crossing into (or growing) a mapping: allocate, copy, release
+    object resized = bucket_alloc(use, size, header.alignment);
+    if (!resized) {
+        return NULL;
+    }
+    memcpy(resized, bucket, keep);
+    array_free_bucket(use, bucket);
+    return resized;
+}
+
+// release a bucket obtained from the array_*_bucket helpers
+void array_free_bucket(sc_alloc_use_t *use, object bucket) {
+    if (!bucket) {
+        return;
+    }
+    bucket_header *header = BUCKET_HEADER(bucket);
+#if defined(__linux__)
+    if (header->mapped) {
+        munmap(header->raw, header->mapped);
+        return;
+    }
+#endif
+    coll_free(use, header->raw);
+}
+
+// alignment request a bucket was allocated under
+usize array_bucket_alignment(const void *bucket) {
+    return bucket ? BUCKET_HEADER(bucket)->alignment : SC_ALIGN_AUTO;
+}
+
+// true if the bucket is a huge-page mapping
+bool array_bucket_is_mapped(const void *bucket) {
+    return bucket && BUCKET_HEADER(bucket)->mapped != 0;
+}
+
+// map a whole file shared, read-only or read-write; NULL if it cannot be opened or is empty
+void *array_map_file(const char *path, bool writable, usize *length_out) {
+#if defined(__unix__) || defined(__APPLE__)
+    void *mapping = NULL;
+    int fd = open(path, writable ? O_RDWR : O_RDONLY);
+    if (fd < 0) {
+        goto exit;
+    }
+    struct stat info;
+    if (fstat(fd, &info) != 0 || info.st_size <= 0) {
+        goto cleanup;
+    }
+    mapping = mmap(NULL, (usize)info.st_size, writable ? PROT_READ | PROT_WRITE : PROT_READ,
+                   MAP_SHARED, fd, 0);
+    if (mapping == MAP_FAILED) {
+        mapping = NULL;
+        goto cleanup;
+    }
+    if (length_out) *length_out = (usize)info.st_size;
+
+cleanup:
+    close(fd);  // the mapping keeps its own reference to the file
+
+exit:
+    return mapping;
+#else
+    (void)path;
+    (void)writable;
+    (void)length_out;
+    return NULL;
+#endif
+}
+
+// flush a writable file mapping to its file
+int array_sync_mapping(void *mapping, usize length) {
+#if defined(__unix__) || defined(__APPLE__)
+    return mapping && msync(mapping, length, MS_SYNC) == 0 ? OK : ERR;
+#else
+    (void)mapping;
+    (void)length;
+    return ERR;
+#endif
+}
+
+// release a file mapping
+void array_unmap(void *mapping, usize length) {
+#if defined(__unix__) || defined(__APPLE__)
+    if (mapping) {
+        munmap(mapping, length);
+    }
+#else
+    (void)mapping;
+    (void)length;
+#endif
 }
 
 // free array resources (bucket and struct)
-void array_free_resources(void *bucket, void *struct_ptr) {
+void array_free_resources(sc_alloc_use_t *use, void *bucket, void *struct_ptr) {
     if (bucket) {
-        Allocator.dispose(bucket);
+        array_free_bucket(use, bucket);
     }
     if (struct_ptr) {
-        Allocator.dispose(struct_ptr);
+        coll_free(use, struct_ptr);
     }
 }
 
 // Common array structure allocation with bucket
 // Handles the common pattern: allocate struct, set handle, allocate bucket, set end, check
 // overflow
-void *array_alloc_struct_with_bucket(usize struct_size, char handle_char, usize element_size,
-                                     usize capacity, void **bucket_out, char **end_out) {
+void *array_alloc_struct_with_bucket(sc_alloc_use_t *use, usize struct_size, char handle_char,
+                                     usize element_size, usize capacity, usize alignment,
+                                     void **bucket_out, char **end_out) {
     // Allocate memory for the array structure
-    void *struct_ptr = Allocator.alloc(struct_size);
+    void *struct_ptr = coll_alloc(use, struct_size);
     if (!struct_ptr) {
         return NULL;
     }
@@ -65,9 +330,9 @@ void *array_alloc_struct_with_bucket(usize struct_size, char handle_char, usize
     ((char *)struct_ptr)[1] = '\0';
 
     // Allocate memory for the bucket
-    void *bucket = array_alloc_bucket(element_size, capacity);
-    if (!bucket && capacity > 0) {
-        Allocator.dispose(struct_ptr);
+    void *bucket = array_alloc_bucket_aligned(use, element_size, capacity, alignment);
+    if (!bucket) {
+        coll_free(use, struct_ptr);
         return NULL;
     }
 
@@ -76,7 +341,7 @@ void *array_alloc_struct_with_bucket(usize struct_size, char handle_char, usize
 
     // Check for pointer arithmetic overflow
     if (capacity > 0 && end < (char *)bucket) {
-        array_free_resources(bucket, struct_ptr);
+        array_free_resources(use, bucket, struct_ptr);
         return NULL;
     }
 
@@ -85,4 +350,305 @@ void *array_alloc_struct_with_bucket(usize struct_size, char handle_char, usize
     if (end_out) *end_out = end;
 
     return struct_ptr;
-}
\ No newline at end of file
+}
+// allocate a zeroed epoch shadow; every slot starts stale (epoch 0)
+uint32_t *array_alloc_epochs(sc_alloc_use_t *use, usize capacity) {
+    if (capacity > SIZE_MAX / sizeof(uint32_t)) {
+        return NULL;  // Would overflow
+    }
+    uint32_t *epochs = coll_alloc(use, sizeof(uint32_t) * (capacity ? capacity : 1));
+    if (epochs) {
+        memset(epochs, 0, sizeof(uint32_t) * capacity);
+    }
+    return epochs;
+}
+
+// resize an epoch shadow, preserving existing stamps; new slots start stale
+int array_resize_epochs(sc_alloc_use_t *use, uint32_t **epochs, usize old_capacity,
+                        usize new_capacity) {
+    uint32_t *resized = array_alloc_epochs(use, new_capacity);
+    if (!resized) {
+        return ERR;
+    }
+    usize keep = old_capacity < new_capacity ? old_capacity : new_capacity;
+    if (*epochs) {
+        memcpy(resized, *epochs, sizeof(uint32_t) * keep);
+        coll_free(use, *epochs);
+    }
+    *epochs = resized;
+    return OK;
+}
+
+// O(1) handle validation against a per-slot generation shadow (same layout as epochs). A handle
+// carries slot generation + the owner's clear generation; both only ever increase, so a clear
+// (one increment of clear_generation) retires every outstanding handle without touching the slots
+int array_check_generation(const uint32_t *generations, uint32_t clear_generation, usize capacity,
+                           sc_handle handle) {
+    usize index = SC_HANDLE_INDEX(handle);
+    if (!generations || index >= capacity) {
+        return ERR;
+    }
+    return (uint32_t)(generations[index] + clear_generation) == SC_HANDLE_GENERATION(handle) ? OK
+                                                                                              : ERR;
+}
+
+// allocate a zeroed occupancy bitmap (every slot free)
+uint64_t *array_alloc_bitmap(sc_alloc_use_t *use, usize capacity) {
+    usize words = BITMAP_WORDS(capacity);
+    uint64_t *bits = coll_alloc(use, sizeof(uint64_t) * (words ? words : 1));
+    if (bits) {
+        memset(bits, 0, sizeof(uint64_t) * (words ? words : 1));
+    }
+    return bits;
+}
+
+// resize an occupancy bitmap, keeping bits below the new capacity; new slots start free
+int array_resize_bitmap(sc_alloc_use_t *use, uint64_t **bits, usize old_capacity,
+                        usize new_capacity) {
+    uint64_t *resized = array_alloc_bitmap(use, new_capacity);
+    if (!resized) {
+        return ERR;
+    }
+    if (*bits) {
+        usize keep = old_capacity < new_capacity ? old_capacity : new_capacity;
+        memcpy(resized, *bits, sizeof(uint64_t) * BITMAP_WORDS(keep));
+        if (keep & 63) {
+            resized[keep >> 6] &= ((uint64_t)1 << (keep & 63)) - 1;  // drop bits past keep
+        }
+        coll_free(use, *bits);
+    }
+    *bits = resized;
+    return OK;
+}
+
+// mark every slot free
+void array_bitmap_reset(uint64_t *bits, usize capacity) {
+    memset(bits, 0, sizeof(uint64_t) * BITMAP_WORDS(capacity));
+}
+
+// mark [from, from + count) live; whole words are filled with one store
+void array_bitmap_set_range(uint64_t *bits, usize from, usize count) {
+    usize end = from + count;
+    while (from < end) {
+        usize bit = from & 63;
+        usize span = 64 - bit < end - from ? 64 - bit : end - from;
+        uint64_t mask = span == 64 ? ~(uint64_t)0 : (((uint64_t)1 << span) - 1) << bit;
+        bits[from >> 6] |= mask;
+        from += span;
+    }
+}
+
+// number of live slots, one popcount per 64 slots
+usize array_bitmap_count(const uint64_t *bits, usize capacity) {
+    usize count = 0;
+    for (usize w = 0; w < BITMAP_WORDS(capacity); w++) {
+        count += (usize)__builtin_popcountll(bits[w]);
+    }
+    return count;
+}
+
+// first free slot in [from, capacity), or capacity if none; skips full words with one compare
+usize array_bitmap_next_clear(const uint64_t *bits, usize capacity, usize from) {
+    while (from < capacity) {
+        uint64_t free = ~bits[from >> 6] & (~(uint64_t)0 << (from & 63));
+        if (free) {
+            usize index = (from & ~(usize)63) + (usize)__builtin_ctzll(free);
+            return index < capacity ? index : capacity;
+        }
+        from = (from | 63) + 1;
+    }
+    return capacity;
+}
+
+// longest run of free slots in O(capacity / 64): a fixed number of steps per bitmap word
+usize array_bitmap_largest_free_run(const uint64_t *bits, usize capacity) {
+    usize best = 0;
+    usize run = 0;  // free run carried across word boundaries
+    usize words = BITMAP_WORDS(capacity);
+
+    for (usize w = 0; w < words; w++) {
+        uint64_t word = bits[w];
+        if (w == words - 1 && (capacity & 63)) {
+            word |= ~(uint64_t)0 << (capacity & 63);  // slots past the end count as occupied
+        }
+        if (word == 0) {
+            run += 64;
+            continue;
+        }
+
+        // low free bits extend the carried run; high free bits start the next one
+        run += (usize)__builtin_ctzll(word);
+        if (run > best) best = run;
+        run = (usize)__builtin_clzll(word);
+
+        // longest interior run in a fixed 6 + 6 steps: pow[k] marks the ends of free runs of
+        // length 2^k, then a binary search extends the longest run found so far by 32, 16, ... 1
+        uint64_t pow[6];
+        pow[0] = ~word;
+        for (int k = 1; k < 6; k++) {
+            pow[k] = pow[k - 1] & (pow[k - 1] << (1u << (k - 1)));
+        }
+        uint64_t ends = ~(uint64_t)0;  // ends of free runs of length `interior`
+        usize interior = 0;
+        for (int k = 5; k >= 0; k--) {
+            uint64_t longer = pow[k] & (ends << (1u << k));
+            if (longer) {
+                ends = longer;
+                interior += (usize)1 << k;
+            }
+        }
+        if (interior > best) best = interior;
+    }
+    return run > best ? run : best;
+}
+
+// external fragmentation: 0 when all free slots form one run, approaching 1 as they scatter
+double array_bitmap_fragmentation(const uint64_t *bits, usize capacity, usize live) {
+    if (live >= capacity) {
+        return 0.0;
+    }
+    usize free = capacity - live;
+    return 1.0 - (double)array_bitmap_largest_free_run(bits, capacity) / (double)free;
+}
+
+// words in a summary: level 1 (one bit per bitmap word) followed by level 2
+static usize bitmap_summary_words(usize capacity, usize *level1_words) {
+    usize words1 = BITMAP_WORDS(BITMAP_WORDS(capacity));
+    if (level1_words) {
+        *level1_words = words1;
+    }
+    return words1 + BITMAP_WORDS(words1);
+}
+
+// allocate a zeroed summary (no word full); matches a freshly allocated bitmap
+uint64_t *array_alloc_bitmap_summary(sc_alloc_use_t *use, usize capacity) {
+    usize words = bitmap_summary_words(capacity, NULL);
+    uint64_t *summary = coll_alloc(use, sizeof(uint64_t) * (words ? words : 1));
+    if (summary) {
+        memset(summary, 0, sizeof(uint64_t) * (words ? words : 1));
+    }
+    return summary;
+}
+
+// replace a summary with one sized for new_capacity, rebuilt from the (already resized) bitmap
+int array_resize_bitmap_summary(sc_alloc_use_t *use, uint64_t **summary, const uint64_t *bits,
+                                usize new_capacity) {
+    uint64_t *resized = array_alloc_bitmap_summary(use, new_capacity);
+    if (!resized) {
+        return ERR;
+    }
+    array_bitmap_summary_rebuild(resized, bits, new_capacity);
+    if (*summary) {
+        coll_free(use, *summary);
+    }
+    *summary = resized;
+    return OK;
+}
+
+// recompute both levels from the bitmap, one compare per 64 slots
+void array_bitmap_summary_rebuild(uint64_t *summary, const uint64_t *bits, usize capacity) {
+    usize words = BITMAP_WORDS(capacity);
+    usize words1;
+    memset(summary, 0, sizeof(uint64_t) * bitmap_summary_words(capacity, &words1));
+    uint64_t *level2 = summary + words1;
+
+    for (usize w = 0; w < words; w++) {
+        if (bits[w] == ~(uint64_t)0) {
+            BITMAP_SET(summary, w);
+        }
+    }
+    for (usize v = 0; v < words1; v++) {
+        if (summary[v] == ~(uint64_t)0) {
+            BITMAP_SET(level2, v);
+        }
+    }
+}
+
+// refresh the summary after bits [from, from + count) changed
+void array_bitmap_summary_update(uint64_t *summary, const uint64_t *bits, usize capacity,
+                                 usize from, usize count) {
+    if (count == 0) {
+        return;
+    }
+    usize words1;
+    bitmap_summary_words(capacity, &words1);
+    uint64_t *level2 = summary + words1;
+
+    for (usize w = from >> 6; w <= (from + count - 1) >> 6; w++) {
+        if (bits[w] == ~(uint64_t)0) {
+            BITMAP_SET(summary, w);
+        } else {
+            BITMAP_CLEAR(summary, w);
+        }
+        usize v = w >> 6;
+        if (summary[v] == ~(uint64_t)0) {
+            BITMAP_SET(level2, v);
+        } else {
+            BITMAP_CLEAR(level2, v);
+        }
+    }
+}
+
+// first bitmap word at or after w that is not full, or words if none
+static usize bitmap_summary_next_open(const uint64_t *summary, usize words, usize w) {
+    usize words1 = BITMAP_WORDS(words);
+    const uint64_t *level2 = summary + words1;
+    if (w >= words) {
+        return words;
+    }
+
+    uint64_t open = ~summary[w >> 6] & (~(uint64_t)0 << (w & 63));
+    if (open) {
+        w = (w & ~(usize)63) + (usize)__builtin_ctzll(open);
+        return w < words ? w : words;
+    }
+
+    // the rest of this level-1 word is full: find the next level-1 word with an open bit
+    usize v = (w >> 6) + 1;
+    if (v >= words1) {
+        return words;
+    }
+    usize u = v >> 6;
+    uint64_t open2 = ~level2[u] & (~(uint64_t)0 << (v & 63));
+    while (!open2) {
+        if (++u >= BITMAP_WORDS(words1)) {
+            return words;
+        }
+        open2 = ~level2[u];
+    }
+    v = (u << 6) + (usize)__builtin_ctzll(open2);
+    if (v >= words1) {
+        return words;
+    }
+    w = (v << 6) + (usize)__builtin_ctzll(~summary[v]);
+    return w < words ? w : words;
+}
+
+// first free slot in [from, capacity), or capacity if none; O(log64 capacity) via the summary
+usize array_bitmap_summary_next_clear(const uint64_t *summary, const uint64_t *bits,
+                                      usize capacity, usize from) {
+    if (from >= capacity) {
+        return capacity;
+    }
+    usize words = BITMAP_WORDS(capacity);
+    usize w = from >> 6;
+    uint64_t free = ~bits[w] & (~(uint64_t)0 << (from & 63));
+    if (!free) {
+        w = bitmap_summary_next_open(summary, words, w + 1);
+        if (w >= words) {
+            return capacity;
+        }
+        free = ~bits[w];
+    }
+    usize index = (w << 6) + (usize)__builtin_ctzll(free);
+    return index < capacity ? index : capacity;
+}
+
+// advance to the next epoch, invalidating every stamped slot in O(1)
+void array_advance_epoch(uint32_t *epochs, usize capacity, uint32_t *epoch) {
+    if (++(*epoch) == 0) {
+        // wrapped: old stamps could alias new epochs, so reset the shadow once per 2^32 clears
+        memset(epochs, 0, sizeof(uint32_t) * capacity);
+        *epoch = 1;
+    }
+}
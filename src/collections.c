@@ -58,6 +58,7 @@ void sparse_iter_dispose(sparse_iterator it);
 struct sparse_iterator_s {
     object sparse_coll;      // The sparse collection (slotarray or indexarray)
     const sc_sparse_i *ops;  // Operations interface
+    sc_alloc_use_t *use;     // Owner's allocator (NULL = Allocator facade)
     usize current;           // Current index (-1 means before start, need to find first)
     usize capacity;          // Cached capacity
     bool positioned;         // Whether iterator is positioned at a valid slot
@@ -65,10 +66,18 @@ struct sparse_iterator_s {
 
 // create a collection view of array data
 collection collection_create_view(void *array, usize stride, usize length, bool owns_buffer) {
-    struct sc_collection *coll = Allocator.alloc(sizeof(struct sc_collection));
+    return collection_create_view_with(NULL, array, stride, length, owns_buffer);
+}
+
+// create a collection view of array data, allocated through the given allocator
+collection collection_create_view_with(sc_alloc_use_t *use, void *array, usize stride,
+                                       usize length, bool owns_buffer) {
+    struct sc_collection *coll = coll_alloc(use, sizeof(struct sc_collection));
     if (!coll) {
         return NULL;
     }
+    coll->use = use;
+    coll->read_only = false;
 
     if (array) {
         // Copy handle from the array to determine storage type
@@ -83,6 +92,7 @@ collection collection_create_view(void *array, usize stride, usize length, bool
             coll->array.end = farr->end;
             coll->stride = stride;  // Use provided stride for values
             coll->owns_buffer = owns_buffer;
+            coll->headed_bucket = true;
         } else if (array_handle == 'P') {
             // parray - store pointers like parray
             sc_array_base *parr = (sc_array_base *)array;
@@ -90,6 +100,7 @@ collection collection_create_view(void *array, usize stride, usize length, bool
             coll->array.end = parr->end;
             coll->stride = sizeof(void *);  // Pointers
             coll->owns_buffer = owns_buffer;
+            coll->headed_bucket = true;
         } else {
             // Unknown array - treat as farray (store values)
             coll->array.handle[0] = 'F';
@@ -98,6 +109,7 @@ collection collection_create_view(void *array, usize stride, usize length, bool
             coll->array.end = NULL;  // unknown
             coll->stride = stride;   // Use provided stride for values
             coll->owns_buffer = owns_buffer;
+            coll->headed_bucket = false;  // caller's buffer: no bucket header in front
         }
     } else {
         // NULL array - treat as farray, store values
@@ -107,6 +119,7 @@ collection collection_create_view(void *array, usize stride, usize length, bool
         coll->array.end = NULL;
         coll->stride = stride;
         coll->owns_buffer = owns_buffer;
+        coll->headed_bucket = false;
     }
 
     coll->length = length;
@@ -115,7 +128,7 @@ collection collection_create_view(void *array, usize stride, usize length, bool
 
 // set collection data from a buffer
 void collection_set_data(collection coll, void *data, usize count) {
-    if (!coll || !data) {
+    if (!coll || !data || coll->read_only) {
         return;
     }
 
@@ -139,12 +152,12 @@ inline void collection_set_length(collection coll, usize length) {
 }
 
 // create a new collection with the specified capacity and stride
-collection collection_new(usize capacity, usize stride) {
+collection collection_new(sc_alloc_use_t *use, usize capacity, usize stride) {
     void *bucket;
     char *end;
 
-    struct sc_collection *coll = array_alloc_struct_with_bucket(sizeof(struct sc_collection), 'P',
-                                                                stride, capacity, &bucket, &end);
+    struct sc_collection *coll = array_alloc_struct_with_bucket(
+        use, sizeof(struct sc_collection), 'P', stride, capacity, SC_ALIGN_AUTO, &bucket, &end);
 
     if (!coll) {
         return NULL;
@@ -155,9 +168,20 @@ collection collection_new(usize capacity, usize stride) {
     coll->stride = stride;
     coll->length = 0;
     coll->owns_buffer = true;
+    coll->headed_bucket = true;
+    coll->read_only = false;
+    coll->use = use;
 
     return coll;
 }
+
+// reallocate an owned bucket; raw view buffers were allocated by the caller without a header
+static void *collection_realloc_bucket(collection coll, usize old_size, usize size) {
+    if (coll->headed_bucket) {
+        return array_realloc_bucket(coll->use, coll->array.bucket, old_size, size);
+    }
+    return coll_realloc(coll->use, coll->array.bucket, old_size, size);
+}
 // dispose of the collection
 void collection_dispose(collection coll) {
     if (!coll) {
@@ -165,9 +189,13 @@ void collection_dispose(collection coll) {
     }
 
     if (coll->owns_buffer && coll->array.bucket) {
-        Allocator.dispose(coll->array.bucket);
+        if (coll->headed_bucket) {
+            array_free_bucket(coll->use, coll->array.bucket);
+        } else {
+            coll_free(coll->use, coll->array.bucket);
+        }
     }
-    Allocator.dispose(coll);
+    coll_free(coll->use, coll);
 }
 // get the Collections library version string
 const char *collection_get_version(void) { return COLLECTIONS_VERSION; }
@@ -180,8 +208,8 @@ usize collection_count(collection coll) {
 }
 // grow the collection
 int collection_grow(collection coll) {
-    if (!coll) {
-        return ERR;
+    if (!coll || !coll->owns_buffer) {
+        return ERR;  // a view's buffer belongs to someone else
     }
     usize current_capacity = ((char *)coll->array.end - (char *)coll->array.bucket) / coll->stride;
     usize new_capacity;
@@ -190,21 +218,40 @@ int collection_grow(collection coll) {
     } else {
         new_capacity = current_capacity * 2;
     }
-    void *new_buffer = Allocator.alloc(coll->stride * new_capacity);
+    void *new_buffer = collection_realloc_bucket(coll, coll->stride * current_capacity,
+                                                 coll->stride * new_capacity);
+    if (!new_buffer) {
+        return ERR;
+    }
+    coll->array.bucket = new_buffer;
+    coll->array.end = (char *)new_buffer + coll->stride * new_capacity;
+    return OK;
+}
+
+// reallocate an owned buffer to new_capacity elements, preserving contents
+int collection_resize(collection coll, usize new_capacity) {
+    if (!coll || !coll->owns_buffer || new_capacity == 0 ||
+        new_capacity > SIZE_MAX / coll->stride) {
+        return ERR;
+    }
+    usize current_capacity = ((char *)coll->array.end - (char *)coll->array.bucket) / coll->stride;
+    void *new_buffer = collection_realloc_bucket(coll, coll->stride * current_capacity,
+                                                 coll->stride * new_capacity);
     if (!new_buffer) {
         return ERR;
     }
 
-    memcpy(new_buffer, coll->array.bucket, coll->stride * current_capacity);
-    Allocator.dispose(coll->array.bucket);
     coll->array.bucket = new_buffer;
     coll->array.end = (char *)new_buffer + coll->stride * new_capacity;
+    if (coll->length > new_capacity) {
+        coll->length = new_capacity;
+    }
     return OK;
 }
 
 // add an element to the collection
 int collection_add(collection coll, object ptr) {
-    if (!coll || !ptr) {
+    if (!coll || !ptr || coll->read_only) {
         return ERR;
     }
 
@@ -231,7 +278,7 @@ int collection_add(collection coll, object ptr) {
 }
 // remove an element from the collection
 int collection_remove(collection coll, object ptr) {
-    if (!coll || !ptr) {
+    if (!coll || !ptr || coll->read_only) {
         return ERR;
     }
 
@@ -262,11 +309,15 @@ int collection_remove(collection coll, object ptr) {
 }
 // clear the collection
 void collection_clear(collection coll) {
-    if (!coll || !coll->array.bucket) {
+    if (!coll || !coll->array.bucket || coll->read_only) {
         return;
     }
-    usize capacity = ((char *)coll->array.end - (char *)coll->array.bucket) / coll->stride;
-    memset(coll->array.bucket, 0, capacity * coll->stride);
+    // owned storage is never read past length, so stale slots are simply overwritten by the next
+    // add; views share their buffer with an array that expects cleared slots to be zero
+    if (!coll->owns_buffer) {
+        usize capacity = ((char *)coll->array.end - (char *)coll->array.bucket) / coll->stride;
+        memset(coll->array.bucket, 0, capacity * coll->stride);
+    }
     coll->length = 0;
 }
 // get count
@@ -275,10 +326,11 @@ usize collection_get_count(collection coll) { return collection_count(coll); }
 /* Create an iterator for a collection */
 iterator collection_create_iterator(collection coll) {
     if (!coll) return NULL;
-    iterator it = Allocator.alloc(sizeof(struct iterator_s));
+    iterator it = coll_alloc(coll->use, sizeof(struct iterator_s));
     if (!it) return NULL;
     it->coll = coll;
     it->current = 0;
+    it->use = coll->use;
     return it;
 }
 
@@ -314,7 +366,7 @@ void iter_reset(iterator it) {
 
 /* Disposes the iterator */
 void iter_dispose(iterator it) {
-    if (it) Allocator.dispose(it);
+    if (it) coll_free(it->use, it);
 }
 
 const sc_iterator_i Iterator = {
@@ -327,18 +379,20 @@ const sc_iterator_i Iterator = {
 /* Sparse Iterator Implementation */
 
 // Create a new sparse iterator
-sparse_iterator sparse_iterator_new(object sparse_coll, const sc_sparse_i *ops) {
+sparse_iterator sparse_iterator_new(sc_alloc_use_t *use, object sparse_coll,
+                                    const sc_sparse_i *ops) {
     if (!sparse_coll || !ops) {
         return NULL;
     }
 
-    sparse_iterator it = Allocator.alloc(sizeof(struct sparse_iterator_s));
+    sparse_iterator it = coll_alloc(use, sizeof(struct sparse_iterator_s));
     if (!it) {
         return NULL;
     }
 
     it->sparse_coll = sparse_coll;
     it->ops = ops;
+    it->use = use;
     it->current = 0;
     it->capacity = ops->capacity(sparse_coll);
     it->positioned = false;  // Not yet positioned at first element
@@ -398,7 +452,7 @@ void sparse_iter_reset(sparse_iterator it) {
 // Dispose iterator
 void sparse_iter_dispose(sparse_iterator it) {
     if (it) {
-        Allocator.dispose(it);
+        coll_free(it->use, it);
     }
 }
 
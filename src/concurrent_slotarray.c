@@ -0,0 +1,303 @@
+/*
+ * Sigma Collections
+ * Copyright (c) 2026 David Boarman (BadKraft) and contributors
+ * QuantumOverride [Q|]
+ * ----------------------------------------------
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * ----------------------------------------------
+ * File: concurrent_slotarray.c
+ * Description: Implementation of ConcurrentSlotArray - lock-free slot allocation
+ */
+
+#include "concurrent_slotarray.h"
+#include <sigma.core/allocator.h>
+#include <limits.h>
+#include <stdatomic.h>
+#include <string.h>
+#include "internal/arrays.h"
+#include "internal/collections.h"
+
+#define CSA_NONE UINT32_MAX      // empty free stack
+#define CSA_MAX_SEGMENTS 32      // segment k holds base << k slots
+#define CSA_MIN_SEGMENT 8        // smallest first segment
+
+// one slot: the stored pointer plus the free stack link used while the slot is vacant
+typedef struct csa_slot {
+    _Atomic(addr) value;     // stored pointer (ADDR_EMPTY = vacant)
+    _Atomic(uint32_t) next;  // next free index while on the free stack
+} csa_slot;
+
+// ConcurrentSlotArray struct: append-only segment table plus tagged free stack
+struct sc_concurrent_slotarray {
+    _Atomic(csa_slot *) segments[CSA_MAX_SEGMENTS];  // published segments, never moved
+    _Atomic(usize) segment_count;                    // segments whose slots are on the stack
+    _Atomic(uint64_t) free_head;  // (ABA tag << 32) | top index (CSA_NONE = empty)
+    usize base;                   // slots in segment 0 (power of two)
+    uint32_t base_shift;          // log2(base)
+    sc_alloc_use_t *use;          // instance allocator (NULL = Allocator facade)
+};
+
+// Forward declarations
+static concurrent_slotarray csa_new(usize capacity);
+static concurrent_slotarray csa_new_with(sc_alloc_use_t *use, usize capacity);
+static void csa_dispose(concurrent_slotarray csa);
+static int csa_get_at(concurrent_slotarray csa, usize index, object *out_value);
+static bool csa_is_empty_slot(concurrent_slotarray csa, usize index);
+static usize csa_capacity(concurrent_slotarray csa);
+
+// Helper functions
+static csa_slot *csa_slot_at(concurrent_slotarray csa, usize index);
+static int csa_pop(concurrent_slotarray csa);
+static void csa_push_chain(concurrent_slotarray csa, uint32_t first, csa_slot *last);
+static int csa_grow(concurrent_slotarray csa, usize segment);
+
+// Create new concurrent slotarray
+static concurrent_slotarray csa_new(usize capacity) { return csa_new_with(NULL, capacity); }
+
+// Create new concurrent slotarray whose segments use the given allocator
+static concurrent_slotarray csa_new_with(sc_alloc_use_t *use, usize capacity) {
+    concurrent_slotarray csa = NULL;
+
+    if (capacity > (usize)INT_MAX / 2) {
+        goto exit;
+    }
+    csa = coll_alloc(use, sizeof(struct sc_concurrent_slotarray));
+    if (!csa) {
+        goto exit;
+    }
+
+    csa->use = use;
+    csa->base = CSA_MIN_SEGMENT;
+    csa->base_shift = 3;
+    while (csa->base < capacity) {
+        csa->base <<= 1;
+        csa->base_shift++;
+    }
+    for (usize k = 0; k < CSA_MAX_SEGMENTS; k++) {
+        atomic_init(&csa->segments[k], NULL);
+    }
+    atomic_init(&csa->segment_count, 0);
+    atomic_init(&csa->free_head, (uint64_t)CSA_NONE);
+
+    if (csa_grow(csa, 0) != OK) {
+        goto cleanup;
+    }
+    goto exit;
+
+cleanup:
+    csa_dispose(csa);
+    csa = NULL;
+
+exit:
+    return csa;
+}
+
+// Dispose of the concurrent slotarray (caller guarantees no concurrent users)
+static void csa_dispose(concurrent_slotarray csa) {
+    if (!csa) {
+        return;
+    }
+    for (usize k = 0; k < CSA_MAX_SEGMENTS; k++) {
+        csa_slot *segment = atomic_load_explicit(&csa->segments[k], memory_order_relaxed);
+        if (segment) {
+            coll_free(csa->use, segment);
+        }
+    }
+    coll_free(csa->use, csa);
+}
+
+// Pop a free index and publish the value into it
+static int csa_add(concurrent_slotarray csa, object value) {
+    if (!csa || !value) {
+        return ERR;
+    }
+
+    for (;;) {
+        int index = csa_pop(csa);
+        if (index >= 0) {
+            csa_slot *slot = csa_slot_at(csa, (usize)index);
+            atomic_store_explicit(&slot->value, (addr)value, memory_order_release);
+            return index;
+        }
+
+        // stack is empty: append the next segment, unless another thread is already linking it
+        usize segment = atomic_load_explicit(&csa->segment_count, memory_order_acquire);
+        if (segment < CSA_MAX_SEGMENTS &&
+            atomic_load_explicit(&csa->segments[segment], memory_order_acquire)) {
+            continue;  // published but not yet linked; its slots arrive momentarily
+        }
+        if (csa_grow(csa, segment) != OK) {
+            return ERR;
+        }
+    }
+}
+
+// Read the value at index with one acquire load
+static int csa_get_at(concurrent_slotarray csa, usize index, object *out_value) {
+    if (!csa || !out_value) {
+        return ERR;
+    }
+    csa_slot *slot = csa_slot_at(csa, index);
+    if (!slot) {
+        return ERR;
+    }
+    addr value = atomic_load_explicit(&slot->value, memory_order_acquire);
+    if (value == ADDR_EMPTY) {
+        return ERR;
+    }
+    *out_value = (object)value;
+    return OK;
+}
+
+// Empty the slot; only the thread that actually emptied it pushes the index back
+static int csa_remove_at(concurrent_slotarray csa, usize index) {
+    if (!csa) {
+        return ERR;
+    }
+    csa_slot *slot = csa_slot_at(csa, index);
+    if (!slot) {
+        return ERR;
+    }
+    if (atomic_exchange_explicit(&slot->value, ADDR_EMPTY, memory_order_acq_rel) == ADDR_EMPTY) {
+        return ERR;  // already vacant (or lost a race with another remove)
+    }
+    csa_push_chain(csa, (uint32_t)index, slot);
+    return OK;
+}
+
+// Check if a slot is empty
+static bool csa_is_empty_slot(concurrent_slotarray csa, usize index) {
+    if (!csa) {
+        return true;
+    }
+    csa_slot *slot = csa_slot_at(csa, index);
+    return !slot || atomic_load_explicit(&slot->value, memory_order_acquire) == ADDR_EMPTY;
+}
+
+// Slots across segments whose indices have been made available
+static usize csa_capacity(concurrent_slotarray csa) {
+    if (!csa) {
+        return 0;
+    }
+    usize segments = atomic_load_explicit(&csa->segment_count, memory_order_acquire);
+    return csa->base * (((usize)1 << segments) - 1);
+}
+
+// Internal ops table for sparse iterator interface
+static const sc_sparse_i csa_sparse_ops = {
+    .is_empty_slot = (bool (*)(object, usize))csa_is_empty_slot,
+    .capacity = (usize (*)(object))csa_capacity,
+    .get_at = (int (*)(object, usize, object *))csa_get_at};
+
+// Create sparse iterator
+static sparse_iterator csa_create_iterator(concurrent_slotarray csa) {
+    if (!csa) {
+        return NULL;
+    }
+    return sparse_iterator_new(csa->use, csa, &csa_sparse_ops);
+}
+
+// Map an index to its slot: segment k covers [base * (2^k - 1), base * (2^(k+1) - 1))
+static csa_slot *csa_slot_at(concurrent_slotarray csa, usize index) {
+    unsigned long long group = ((unsigned long long)index >> csa->base_shift) + 1;
+    usize segment = (usize)(63 - __builtin_clzll(group));
+    if (segment >= CSA_MAX_SEGMENTS) {
+        return NULL;
+    }
+    csa_slot *slots = atomic_load_explicit(&csa->segments[segment], memory_order_acquire);
+    if (!slots) {
+        return NULL;
+    }
+    return &slots[index - csa->base * (((usize)1 << segment) - 1)];
+}
+
+// Pop the top free index; the tag makes a concurrently popped-and-repushed top fail the CAS
+static int csa_pop(concurrent_slotarray csa) {
+    uint64_t head = atomic_load_explicit(&csa->free_head, memory_order_acquire);
+    for (;;) {
+        uint32_t top = (uint32_t)head;
+        if (top == CSA_NONE) {
+            return ERR;
+        }
+        uint32_t next =
+            atomic_load_explicit(&csa_slot_at(csa, top)->next, memory_order_relaxed);
+        uint64_t desired = (((head >> 32) + 1) << 32) | next;
+        if (atomic_compare_exchange_weak_explicit(&csa->free_head, &head, desired,
+                                                  memory_order_acquire,
+                                                  memory_order_acquire)) {
+            return (int)top;
+        }
+    }
+}
+
+// Push a pre-linked chain first..last (a single index when first == last)
+static void csa_push_chain(concurrent_slotarray csa, uint32_t first, csa_slot *last) {
+    uint64_t head = atomic_load_explicit(&csa->free_head, memory_order_relaxed);
+    uint64_t desired;
+    do {
+        atomic_store_explicit(&last->next, (uint32_t)head, memory_order_relaxed);
+        desired = (((head >> 32) + 1) << 32) | first;
+    } while (!atomic_compare_exchange_weak_explicit(&csa->free_head, &head, desired,
+                                                    memory_order_release,
+                                                    memory_order_relaxed));
+}
+
+// Publish segment k and push its slots; a thread that loses the publish race backs off
+static int csa_grow(concurrent_slotarray csa, usize segment) {
+    if (segment >= CSA_MAX_SEGMENTS) {
+        return ERR;
+    }
+    usize first = csa->base * (((usize)1 << segment) - 1);
+    usize size = csa->base << segment;
+    if (first + size > (usize)INT_MAX) {
+        return ERR;  // handles are int
+    }
+
+    csa_slot *slots = coll_alloc(csa->use, sizeof(csa_slot) * size);
+    if (!slots) {
+        return ERR;
+    }
+    for (usize i = 0; i < size; i++) {
+        atomic_init(&slots[i].value, ADDR_EMPTY);
+        atomic_init(&slots[i].next, (uint32_t)(first + i + 1));
+    }
+
+    csa_slot *expected = NULL;
+    if (!atomic_compare_exchange_strong_explicit(&csa->segments[segment], &expected, slots,
+                                                 memory_order_acq_rel, memory_order_acquire)) {
+        coll_free(csa->use, slots);
+        return OK;  // another thread published this segment and is linking its slots
+    }
+    csa_push_chain(csa, (uint32_t)first, &slots[size - 1]);
+    atomic_store_explicit(&csa->segment_count, segment + 1, memory_order_release);
+    return OK;
+}
+
+// Public interface implementation
+const sc_concurrent_slotarray_i ConcurrentSlotArray = {
+    .new = csa_new,
+    .new_with = csa_new_with,
+    .dispose = csa_dispose,
+    .add = csa_add,
+    .get_at = csa_get_at,
+    .remove_at = csa_remove_at,
+    .is_empty_slot = csa_is_empty_slot,
+    .capacity = csa_capacity,
+    .create_iterator = csa_create_iterator,
+};
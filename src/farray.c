@@ -36,8 +36,12 @@
 #include "internal/array_base.h"
 #include "internal/arrays.h"
 #include "internal/collections.h"
+#include "sc_fast.h"
 // ------------------------------
 #include <sigma.core/allocator.h>
+#include <limits.h>
+#include <stddef.h>
+#include <stdio.h>
 #include <string.h>
 
 //  declare the FlexArray struct: the collection with attitude
@@ -45,31 +49,88 @@ struct sc_flex_array {
     char handle[2];  // {'F', '\0'} - type identifier
     void *bucket;    // pointer to first element (raw bytes)
     void *end;       // one past allocated memory
+    uint32_t *epochs;  // per-slot epoch stamps (NULL unless created by new_epoch)
+    uint32_t epoch;    // current epoch; slots stamped otherwise read as empty
+    bool stale;        // some slot still holds bytes from before its epoch went stale
+    sc_alloc_use_t *use;  // instance allocator (NULL = Allocator facade)
+    void *mapping;        // whole-file mapping from map_file (bucket starts past its header)
+    usize mapped;         // mapping length in bytes
+    bool read_only;       // mapped without write access: set, remove and clear refuse
 };
 
+// sc_fast.h and array_base read the leading fields directly
+_Static_assert(offsetof(struct sc_flex_array, bucket) == offsetof(sc_fast_head, bucket) &&
+                   offsetof(struct sc_flex_array, end) == offsetof(sc_fast_head, end),
+               "sc_flex_array layout must start with sc_fast_head");
+
+// file layout written by save_file and read by map_file: header, then elements from header_bytes
+#define FARRAY_FILE_MAGIC "SCFARRAY"
+#define FARRAY_FILE_VERSION 1
+#define FARRAY_FILE_HEADER_BYTES 4096  // elements start on a page boundary
+typedef struct farray_file_header {
+    char magic[8];          // FARRAY_FILE_MAGIC, not NUL-terminated
+    uint32_t version;       // FARRAY_FILE_VERSION
+    uint32_t header_bytes;  // offset of element 0
+    uint64_t stride;        // element size in bytes
+    uint64_t count;         // number of elements
+} farray_file_header;
+
 #if 1  // Region: Forward declarations
 // API functions
 static farray farray_new(usize, usize);
+static farray farray_new_with(sc_alloc_use_t *, usize, usize);
+static farray farray_new_epoch(usize, usize);
+static farray farray_new_epoch_with(sc_alloc_use_t *, usize, usize);
+static farray farray_new_aligned(usize, usize, usize);
+static farray farray_map_file(const char *, usize, int);
+static int farray_save_file(farray, const char *, usize);
+static int farray_sync(farray);
 static void farray_init(farray *, usize, usize);
+static int farray_resize(farray, usize, usize);
+static int farray_reserve(farray, usize, usize);
 static void farray_dispose(farray);
 static int farray_capacity(farray, usize);
 static void farray_clear(farray, usize);
 static int farray_set_at(farray, usize, usize, object);
 static int farray_get_at(farray, usize, usize, object);
 static int farray_remove_at(farray, usize, usize);
+static int farray_find(farray, usize, object, usize);
+static int farray_find_any(farray, usize, object, usize, usize);
+static usize farray_count_eq(farray, usize, object);
 
 // Collection interface functions
 static collection farray_as_collection(farray arr, usize stride);
 static collection farray_to_collection(farray arr, usize stride);
+
+// Helper functions
+static bool farray_is_stale(farray arr, usize index);
+static usize farray_epoch_find(farray arr, usize stride, object values, usize count, usize from);
+static usize farray_epoch_count_eq(farray arr, usize stride, object value);
+static usize farray_epoch_compact(farray arr, usize stride);
+static farray farray_new_aligned_with(sc_alloc_use_t *use, usize capacity, usize stride,
+                                      usize alignment);
 #endif
 
 // API function implementations
 static farray farray_new(usize capacity, usize stride) {
+    return farray_new_with(NULL, capacity, stride);
+}
+
+static farray farray_new_with(sc_alloc_use_t *use, usize capacity, usize stride) {
+    return farray_new_aligned_with(use, capacity, stride, SC_ALIGN_AUTO);
+}
+
+static farray farray_new_aligned(usize capacity, usize stride, usize alignment) {
+    return farray_new_aligned_with(NULL, capacity, stride, alignment);
+}
+
+static farray farray_new_aligned_with(sc_alloc_use_t *use, usize capacity, usize stride,
+                                      usize alignment) {
     void *bucket;
     char *end;
 
-    struct sc_flex_array *arr = array_alloc_struct_with_bucket(sizeof(struct sc_flex_array), 'F',
-                                                               stride, capacity, &bucket, &end);
+    struct sc_flex_array *arr = array_alloc_struct_with_bucket(
+        use, sizeof(struct sc_flex_array), 'F', stride, capacity, alignment, &bucket, &end);
 
     if (!arr) {
         return NULL;
@@ -77,11 +138,43 @@ static farray farray_new(usize capacity, usize stride) {
 
     arr->bucket = bucket;
     arr->end = end;
+    arr->epochs = NULL;
+    arr->epoch = 0;
+    arr->stale = false;
+    arr->use = use;
+    arr->mapping = NULL;
+    arr->mapped = 0;
+    arr->read_only = false;
 
     farray_clear(arr, stride);
     return (farray)arr;
 }
 
+static farray farray_new_epoch(usize capacity, usize stride) {
+    return farray_new_epoch_with(NULL, capacity, stride);
+}
+
+static farray farray_new_epoch_with(sc_alloc_use_t *use, usize capacity, usize stride) {
+    farray arr = farray_new_with(use, capacity, stride);
+    if (!arr) {
+        goto exit;
+    }
+
+    arr->epochs = array_alloc_epochs(arr->use, capacity);
+    if (!arr->epochs) {
+        goto cleanup;
+    }
+    arr->epoch = 1;
+    goto exit;
+
+cleanup:
+    farray_dispose(arr);
+    arr = NULL;
+
+exit:
+    return arr;
+}
+
 static void farray_init(farray *arr, usize capacity, usize stride) {
     // we expect the arr to be uninitialized
     if (!*arr) {
@@ -89,43 +182,211 @@ static void farray_init(farray *arr, usize capacity, usize stride) {
         *arr = farray_new(capacity, stride);
     } else {
         // what to do about an farray that's already initialized?
-        // for now, we just reallocate the bucket
-        if ((*arr)->bucket) {
-            Allocator.dispose((*arr)->bucket);
+        // for now, we just reallocate the bucket, keeping its alignment request
+        usize alignment = SC_ALIGN_AUTO;
+        if ((*arr)->mapping) {
+            // a file-backed array becomes an ordinary heap array; the file keeps its contents
+            farray_sync(*arr);
+            array_unmap((*arr)->mapping, (*arr)->mapped);
+            (*arr)->mapping = NULL;
+            (*arr)->mapped = 0;
+            (*arr)->read_only = false;
+        } else {
+            alignment = array_bucket_alignment((*arr)->bucket);
+            array_free_bucket((*arr)->use, (*arr)->bucket);
         }
-        (*arr)->bucket = Allocator.alloc(stride * capacity);
+        (*arr)->bucket = array_alloc_bucket_aligned((*arr)->use, stride, capacity, alignment);
         if (!(*arr)->bucket) {
             // allocation ERRed, handle error as needed
             return;
         }
         (*arr)->end = (char *)((*arr)->bucket) + stride * capacity;
+
+        // a re-initialized bucket holds garbage: restart the epoch so every slot reads empty
+        if ((*arr)->epochs) {
+            coll_free((*arr)->use, (*arr)->epochs);
+            (*arr)->epochs = array_alloc_epochs((*arr)->use, capacity);
+            (*arr)->epoch = 1;
+            (*arr)->stale = true;
+        }
     }
 }
 
+// change capacity in place; contents are preserved and only a new tail is zeroed
+static int farray_resize(farray arr, usize new_capacity, usize stride) {
+    return farray_resize_bucket(arr, stride, new_capacity);
+}
+
+// grow to at least min_capacity; never shrinks
+static int farray_reserve(farray arr, usize min_capacity, usize stride) {
+    if (!arr || stride == 0) {
+        return ERR;
+    }
+    if ((usize)farray_capacity(arr, stride) >= min_capacity) {
+        return OK;
+    }
+    return farray_resize_bucket(arr, stride, min_capacity);
+}
+
 static void farray_dispose(farray arr) {
     if (!arr) {
         return;  // nothing to dispose
     }
 
     //  free the bucket and the farray structure itself
-    array_free_resources(arr->bucket, arr);
+    if (arr->epochs) {
+        coll_free(arr->use, arr->epochs);
+    }
+    if (arr->mapping) {
+        // stores reach the file; the bucket belongs to the mapping
+        farray_sync(arr);
+        array_unmap(arr->mapping, arr->mapped);
+        array_free_resources(arr->use, NULL, arr);
+        return;
+    }
+    array_free_resources(arr->use, arr->bucket, arr);
+}
+
+// map a file written by save_file; elements are read (and written) in place, shared with every
+// other process mapping the same file
+static farray farray_map_file(const char *path, usize stride, int flags) {
+    struct sc_flex_array *arr = NULL;
+    bool writable = (flags & FARRAY_MAP_WRITE) != 0;
+    usize length = 0;
+    char *mapping = NULL;
+    const farray_file_header *header;
+
+    if (!path || stride == 0) {
+        goto exit;
+    }
+    mapping = array_map_file(path, writable, &length);
+    if (!mapping) {
+        goto exit;
+    }
+
+    // the header must describe this stride and fit the file; capacity is reported as int
+    header = (const farray_file_header *)mapping;
+    if (length < sizeof(farray_file_header) ||
+        memcmp(header->magic, FARRAY_FILE_MAGIC, sizeof(header->magic)) != 0 ||
+        header->version != FARRAY_FILE_VERSION || header->stride != stride ||
+        header->header_bytes < sizeof(farray_file_header) || header->header_bytes > length ||
+        header->count > (length - header->header_bytes) / stride || header->count > INT_MAX) {
+        goto cleanup;
+    }
+
+    arr = coll_alloc(NULL, sizeof(struct sc_flex_array));
+    if (!arr) {
+        goto cleanup;
+    }
+    arr->handle[0] = 'F';
+    arr->handle[1] = '\0';
+    arr->bucket = mapping + header->header_bytes;
+    arr->end = (char *)arr->bucket + header->count * stride;
+    arr->epochs = NULL;
+    arr->epoch = 0;
+    arr->stale = false;
+    arr->use = NULL;
+    arr->mapping = mapping;
+    arr->mapped = length;
+    arr->read_only = !writable;
+    goto exit;
+
+cleanup:
+    array_unmap(mapping, length);
+
+exit:
+    return arr;
+}
+
+// write the array to a file in the map_file layout (created or truncated)
+static int farray_save_file(farray arr, const char *path, usize stride) {
+    int result = ERR;
+    FILE *file = NULL;
+
+    if (!arr || !path || stride == 0) {
+        goto exit;
+    }
+    file = fopen(path, "wb");
+    if (!file) {
+        goto exit;
+    }
+
+    farray_epoch_sync(arr, stride);  // stale epoch slots are saved as zero
+    usize count = (usize)farray_capacity(arr, stride);
+    farray_file_header header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, FARRAY_FILE_MAGIC, sizeof(header.magic));
+    header.version = FARRAY_FILE_VERSION;
+    header.header_bytes = FARRAY_FILE_HEADER_BYTES;
+    header.stride = stride;
+    header.count = count;
+
+    static const char padding[FARRAY_FILE_HEADER_BYTES];
+    if (fwrite(&header, sizeof(header), 1, file) != 1 ||
+        fwrite(padding, FARRAY_FILE_HEADER_BYTES - sizeof(header), 1, file) != 1 ||
+        (count && fwrite(arr->bucket, stride, count, file) != count)) {
+        goto cleanup;
+    }
+    result = OK;
+
+cleanup:
+    if (fclose(file) != 0) {
+        result = ERR;
+    }
+
+exit:
+    return result;
+}
+
+// flush stores on a writable file mapping to the file; no-op for heap arrays
+static int farray_sync(farray arr) {
+    if (!arr) {
+        return ERR;
+    }
+    if (!arr->mapping || arr->read_only) {
+        return OK;
+    }
+    return array_sync_mapping(arr->mapping, arr->mapped);
 }
 
 static void farray_clear(farray arr, usize stride) {
-    array_base_clear((sc_array_base *)arr, stride, farray_element_clear);
+    if (arr && arr->read_only) {
+        return;
+    }
+    if (arr && arr->epochs) {
+        // epoch mode: stale slots are reclaimed lazily by the next set
+        array_advance_epoch(arr->epochs, farray_capacity(arr, stride), &arr->epoch);
+        arr->stale = true;
+        return;
+    }
+    array_base_zero((sc_array_base *)arr);
 }
 
 static int farray_set_at(farray arr, usize index, usize stride, object value) {
-    return array_base_set_element((sc_array_base *)arr, stride, index, value, farray_element_copy);
+    if (arr && arr->read_only) {
+        return ERR;
+    }
+    int result = array_base_store((sc_array_base *)arr, stride, index, value);
+    if (result == OK && arr->epochs) {
+        arr->epochs[index] = arr->epoch;
+    }
+    return result;
 }
 
 static int farray_get_at(farray arr, usize index, usize stride, object out_value) {
-    return array_base_get_element((sc_array_base *)arr, stride, index, out_value,
-                                  farray_element_copy);
+    int result = array_base_load((sc_array_base *)arr, stride, index, out_value);
+    if (result == OK && farray_is_stale(arr, index)) {
+        // slot predates the last clear: it reads as empty
+        farray_element_clear(out_value, stride);
+    }
+    return result;
 }
 
 static int farray_remove_at(farray arr, usize index, usize stride) {
-    return array_base_remove_element((sc_array_base *)arr, stride, index, farray_element_clear);
+    if (arr && arr->read_only) {
+        return ERR;
+    }
+    return array_base_zero_element((sc_array_base *)arr, stride, index);
 }
 
 #if 1  // Region: Internal utility functions
@@ -133,10 +394,89 @@ static int farray_capacity(farray arr, usize stride) {
     return array_base_capacity((sc_array_base *)arr, stride);
 }
 
+static int farray_find(farray arr, usize stride, object value, usize from) {
+    return farray_find_any(arr, stride, value, 1, from);
+}
+
+static int farray_find_any(farray arr, usize stride, object values, usize count, usize from) {
+    if (!values || count == 0 || stride == 0) {
+        return ERR;
+    }
+    usize capacity = (usize)farray_capacity(arr, stride);
+    if (from >= capacity) {
+        return ERR;
+    }
+    if (arr->stale) {
+        usize hit = farray_epoch_find(arr, stride, values, count, from);
+        return hit < capacity ? (int)hit : ERR;
+    }
+    usize hit = array_simd_find((char *)arr->bucket + from * stride, capacity - from, stride,
+                                values, count);
+    return hit < capacity - from ? (int)(from + hit) : ERR;
+}
+
+static usize farray_count_eq(farray arr, usize stride, object value) {
+    if (!value || stride == 0) {
+        return 0;
+    }
+    usize capacity = (usize)farray_capacity(arr, stride);
+    if (capacity == 0) {
+        return 0;
+    }
+    if (arr->stale) {
+        return farray_epoch_count_eq(arr, stride, value);
+    }
+    return array_simd_count_eq(arr->bucket, capacity, stride, value);
+}
+
+// raw element storage for derived structures
+void *farray_get_bucket(farray arr) {
+    if (!arr) return NULL;
+    return arr->bucket;
+}
+
+// reallocate the bucket to new_capacity elements, preserving contents and zeroing any new tail
+int farray_resize_bucket(farray arr, usize stride, usize new_capacity) {
+    if (!arr || arr->mapping || stride == 0 || new_capacity == 0 || new_capacity > INT_MAX ||
+        new_capacity > SIZE_MAX / stride) {
+        return ERR;  // a file mapping has the file's size; capacity is reported as int
+    }
+    usize old_capacity = farray_capacity(arr, stride);
+    if (new_capacity == old_capacity) {
+        return OK;
+    }
+    // the epoch shadow must always cover the bucket: grow it first, shrink it only after the
+    // bucket has shrunk (a shadow left longer on failure is harmless)
+    if (arr->epochs && new_capacity > old_capacity &&
+        array_resize_epochs(arr->use, &arr->epochs, old_capacity, new_capacity) != OK) {
+        return ERR;
+    }
+
+    char *bucket =
+        array_realloc_bucket(arr->use, arr->bucket, stride * old_capacity, stride * new_capacity);
+    if (!bucket) {
+        return ERR;  // original bucket is left intact
+    }
+    if (new_capacity > old_capacity) {
+        memset(bucket + stride * old_capacity, 0, stride * (new_capacity - old_capacity));
+    }
+    arr->bucket = bucket;
+    arr->end = bucket + stride * new_capacity;
+    if (arr->epochs && new_capacity < old_capacity) {
+        array_resize_epochs(arr->use, &arr->epochs, old_capacity, new_capacity);
+    }
+    return OK;
+}
+
 // compact the array by shifting non-zero elements to the front
 usize farray_compact(farray arr, usize stride) {
-    return array_base_compact((sc_array_base *)arr, stride, farray_element_is_empty,
-                              farray_element_copy, farray_element_clear);
+    if (arr && arr->read_only) {
+        return 0;  // a read-only mapping cannot be rearranged
+    }
+    if (arr && arr->stale) {
+        return farray_epoch_compact(arr, stride);
+    }
+    return array_base_compact_zero((sc_array_base *)arr, stride);
 }
 #endif
 
@@ -147,8 +487,13 @@ static collection farray_as_collection(farray arr, usize stride) {
         return NULL;
     }
 
+    farray_epoch_sync(arr, stride);  // a raw view cannot consult the epochs
     usize length = FArray.capacity(arr, stride);
-    return Collections.create_view(arr, stride, length, false);
+    collection coll = collection_create_view_with(arr->use, arr, stride, length, false);
+    if (coll) {
+        coll->read_only = arr->read_only;  // the view must not write a read-only mapping
+    }
+    return coll;
 }
 
 // create an owning collection copy of the farray
@@ -158,7 +503,7 @@ static collection farray_to_collection(farray arr, usize stride) {
     }
 
     usize capacity = FArray.capacity(arr, stride);
-    collection coll = collection_new(capacity, stride);
+    collection coll = collection_new(arr->use, capacity, stride);
     if (!coll) {
         return NULL;
     }
@@ -166,24 +511,145 @@ static collection farray_to_collection(farray arr, usize stride) {
     // Treat as farray for storage
     coll->array.handle[0] = 'F';
 
-    // Copy data
+    // Copy data; stale epoch slots are zeroed in the copy, leaving the source untouched
     void *src = arr->bucket;
     collection_set_data(coll, src, capacity);
+    if (arr->stale) {
+        char *dst = collection_get_buffer(coll);
+        for (usize i = 0; i < capacity; ++i) {
+            if (farray_is_stale(arr, i)) {
+                farray_element_clear(dst + i * stride, stride);
+            }
+        }
+    }
 
     return coll;
 }
 #endif
 
+#if 1  // Region: Helper functions
+// check whether a slot was last written before the current epoch
+static bool farray_is_stale(farray arr, usize index) {
+    return arr->epochs && arr->epochs[index] != arr->epoch;
+}
+
+// first index in [from, capacity) equal to one of values, capacity if none; live runs go through
+// the vector kernel and stale slots compare as zero without being written
+static usize farray_epoch_find(farray arr, usize stride, object values, usize count, usize from) {
+    usize capacity = farray_capacity(arr, stride);
+    bool zero_wanted = false;
+    for (usize k = 0; k < count && !zero_wanted; ++k) {
+        zero_wanted = farray_element_is_empty((char *)values + k * stride, stride);
+    }
+
+    usize i = from;
+    while (i < capacity) {
+        if (farray_is_stale(arr, i)) {
+            if (zero_wanted) {
+                return i;
+            }
+            ++i;
+            continue;
+        }
+        usize run = i + 1;
+        while (run < capacity && !farray_is_stale(arr, run)) {
+            ++run;
+        }
+        usize hit =
+            array_simd_find((char *)arr->bucket + i * stride, run - i, stride, values, count);
+        if (hit < run - i) {
+            return i + hit;
+        }
+        i = run;
+    }
+    return capacity;
+}
+
+// count elements equal to value, counting stale slots as zero
+static usize farray_epoch_count_eq(farray arr, usize stride, object value) {
+    usize capacity = farray_capacity(arr, stride);
+    bool zero_wanted = farray_element_is_empty(value, stride);
+    usize total = 0;
+
+    usize i = 0;
+    while (i < capacity) {
+        if (farray_is_stale(arr, i)) {
+            total += zero_wanted;
+            ++i;
+            continue;
+        }
+        usize run = i + 1;
+        while (run < capacity && !farray_is_stale(arr, run)) {
+            ++run;
+        }
+        total += array_simd_count_eq((char *)arr->bucket + i * stride, run - i, stride, value);
+        i = run;
+    }
+    return total;
+}
+
+// compact live non-zero elements to the front; the tail is retired by stamp, not zeroed
+static usize farray_epoch_compact(farray arr, usize stride) {
+    usize capacity = farray_capacity(arr, stride);
+    char *bucket = arr->bucket;
+    usize live = 0;
+
+    for (usize i = 0; i < capacity; ++i) {
+        char *slot = bucket + i * stride;
+        if (farray_is_stale(arr, i) || farray_element_is_empty(slot, stride)) {
+            continue;
+        }
+        if (i != live) {
+            farray_element_copy(bucket + live * stride, slot, stride);
+        }
+        arr->epochs[live++] = arr->epoch;
+    }
+    for (usize i = live; i < capacity; ++i) {
+        arr->epochs[i] = 0;  // epoch 0 is never current
+    }
+    return live;
+}
+
+// zero every stale slot so raw bucket consumers observe the cleared state; O(1) when no clear
+// happened since the last sync
+void farray_epoch_sync(farray arr, usize stride) {
+    if (!arr || !arr->stale) {
+        return;
+    }
+
+    usize capacity = farray_capacity(arr, stride);
+    for (usize i = 0; i < capacity; ++i) {
+        if (arr->epochs[i] != arr->epoch) {
+            farray_element_clear((char *)arr->bucket + i * stride, stride);
+            arr->epochs[i] = arr->epoch;
+        }
+    }
+    arr->stale = false;
+}
+#endif
+
 //  public interface implementation
 const sc_farray_i FArray = {
     .new = farray_new,
+    .new_with = farray_new_with,
+    .new_epoch = farray_new_epoch,
+    .new_epoch_with = farray_new_epoch_with,
+    .new_aligned = farray_new_aligned,
+    .map_file = farray_map_file,
+    .save_file = farray_save_file,
+    .sync = farray_sync,
     .init = farray_init,
+    .resize = farray_resize,
+    .reserve = farray_reserve,
     .dispose = farray_dispose,
     .capacity = farray_capacity,
     .clear = farray_clear,
     .set = farray_set_at,
     .get = farray_get_at,
     .remove = farray_remove_at,
+    .find = farray_find,
+    .find_any = farray_find_any,
+    .count_eq = farray_count_eq,
     .as_collection = farray_as_collection,
     .to_collection = farray_to_collection,
 };
\ No newline at end of file
@@ -27,7 +27,9 @@
 
 #include "indexarray.h"
 #include <sigma.core/allocator.h>
+#include <limits.h>
 #include <string.h>
+#include "internal/array_base.h"
 #include "internal/arrays.h"
 #include "internal/collections.h"
 
@@ -35,10 +37,17 @@
 struct sc_indexarray {
     collection coll;  // underlying collection (handles stride, growth, ownership)
     usize next_slot;  // next slot to check for reuse
+    uint32_t *generations;  // per-slot generation counters (NULL until a handle is issued)
+    uint32_t clear_generation;  // added to every slot generation in handles; bumped by clear
+    uint64_t *occupancy;    // occupancy bitmap, one bit per slot (set = live); sole emptiness test
+    uint64_t *summary;      // full-word summary over occupancy; finds free slots in O(log64 n)
+    usize live;             // number of occupied slots
+    sc_alloc_use_t *use;  // instance allocator (NULL = Allocator facade)
 };
 
 // Forward declarations
 static indexarray indexarray_new(usize capacity, usize stride);
+static indexarray indexarray_new_with(sc_alloc_use_t *use, usize capacity, usize stride);
 static void indexarray_dispose(indexarray ia);
 static int indexarray_add(indexarray ia, object value);
 static int indexarray_get_at(indexarray ia, usize index, object out_value);
@@ -51,35 +60,121 @@ static usize indexarray_stride(indexarray ia);
 static void indexarray_clear(indexarray ia);
 static sparse_iterator indexarray_create_iterator(indexarray ia);
 
-// Helper: check if a slot is empty (all zeros)
+// Helper: check if raw bytes are all zero (only for inferring occupancy from foreign buffers)
 static bool is_slot_empty(object slot_ptr, usize stride) {
-    byte *bytes = (byte *)slot_ptr;
-    for (usize i = 0; i < stride; i++) {
-        if (bytes[i] != 0) {
-            return false;
-        }
-    }
-    return true;
+    return array_kernel_is_zero(slot_ptr, stride);
 }
 
 // Helper: zero out a slot
 static void zero_slot(object slot_ptr, usize stride) { memset(slot_ptr, 0, stride); }
 
+// Helper: check if a slot is empty with one bit test; slot contents are never inspected
+static bool indexarray_slot_empty(indexarray ia, usize index) {
+    return !BITMAP_TEST(ia->occupancy, index);
+}
+
+// Helper: first free slot at or after from, or capacity if none
+static usize indexarray_next_free(indexarray ia, usize capacity, usize from) {
+    return array_bitmap_summary_next_clear(ia->summary, ia->occupancy, capacity, from);
+}
+
+// Helper: refresh the free-slot summary after occupancy bits [from, from + count) changed
+static void indexarray_occupancy_changed(indexarray ia, usize from, usize count) {
+    array_bitmap_summary_update(ia->summary, ia->occupancy, indexarray_capacity(ia), from, count);
+}
+
+// Helper: infer the occupancy bitmap and live count of a foreign buffer (all-zero = empty)
+static void indexarray_recount(indexarray ia) {
+    usize capacity = indexarray_capacity(ia);
+    usize stride = collection_get_stride(ia->coll);
+    char *buffer = collection_get_buffer(ia->coll);
+
+    array_bitmap_reset(ia->occupancy, capacity);
+    ia->live = 0;
+    for (usize i = 0; i < capacity; i++) {
+        if (!is_slot_empty(buffer + i * stride, stride)) {
+            BITMAP_SET(ia->occupancy, i);
+            ia->live++;
+        }
+    }
+    array_bitmap_summary_rebuild(ia->summary, ia->occupancy, capacity);
+}
+
+// Helper: double an owned buffer and its side tables; new slots start zeroed and empty.
+// Side tables are built for the new capacity first and swapped in only once the bucket has
+// grown, so a failed allocation anywhere leaves the indexarray exactly as it was
+static int indexarray_grow(indexarray ia) {
+    if (!ia->coll->owns_buffer) {
+        return ERR;  // views cannot reallocate the caller's buffer
+    }
+    usize old_capacity = indexarray_capacity(ia);
+    usize capacity = old_capacity ? old_capacity * 2 : 8;  // collection_grow's policy
+    if (capacity < old_capacity || capacity > INT_MAX) {
+        return ERR;  // slot indices are returned as int
+    }
+
+    uint32_t *generations = NULL;
+    uint64_t *occupancy = array_alloc_bitmap(ia->use, capacity);
+    uint64_t *summary = array_alloc_bitmap_summary(ia->use, capacity);
+    if (ia->generations) {
+        generations = array_alloc_epochs(ia->use, capacity);
+    }
+    if (!occupancy || !summary || (ia->generations && !generations) ||
+        collection_resize(ia->coll, capacity) != OK) {
+        if (occupancy) coll_free(ia->use, occupancy);
+        if (summary) coll_free(ia->use, summary);
+        if (generations) coll_free(ia->use, generations);
+        return ERR;
+    }
+
+    // commit: bits past old_capacity are already clear in the old bitmap's last word
+    memcpy(occupancy, ia->occupancy, sizeof(uint64_t) * BITMAP_WORDS(old_capacity));
+    array_bitmap_summary_rebuild(summary, occupancy, capacity);
+    coll_free(ia->use, ia->occupancy);
+    coll_free(ia->use, ia->summary);
+    ia->occupancy = occupancy;
+    ia->summary = summary;
+    if (generations) {
+        memcpy(generations, ia->generations, sizeof(uint32_t) * old_capacity);
+        coll_free(ia->use, ia->generations);
+        ia->generations = generations;
+    }
+
+    // Zero out new space
+    usize stride = collection_get_stride(ia->coll);
+    char *buffer = collection_get_buffer(ia->coll);
+    memset(buffer + old_capacity * stride, 0, (capacity - old_capacity) * stride);
+    return OK;
+}
+
+// Helper: allocate the generation shadow on first use so plain indexarrays pay nothing
+static int indexarray_generations_ensure(indexarray ia) {
+    if (!ia->generations) {
+        ia->generations = array_alloc_epochs(ia->use, indexarray_capacity(ia));
+    }
+    return ia->generations ? OK : ERR;
+}
+
 // Create new indexarray with specified capacity and stride
 static indexarray indexarray_new(usize capacity, usize stride) {
+    return indexarray_new_with(NULL, capacity, stride);
+}
+
+// Create new indexarray whose allocations, including growth, use the given allocator
+static indexarray indexarray_new_with(sc_alloc_use_t *use, usize capacity, usize stride) {
     indexarray ia = NULL;
 
     if (stride == 0) {
         goto exit;
     }
 
-    ia = Allocator.alloc(sizeof(struct sc_indexarray));
+    ia = coll_alloc(use, sizeof(struct sc_indexarray));
     if (!ia) {
         goto exit;
     }
 
     // Create underlying collection with stride
-    ia->coll = collection_new(capacity, stride);
+    ia->coll = collection_new(use, capacity, stride);
     if (!ia->coll) {
         goto cleanup;
     }
@@ -90,11 +185,24 @@ static indexarray indexarray_new(usize capacity, usize stride) {
         memset(buffer, 0, capacity * stride);
     }
 
+    ia->occupancy = array_alloc_bitmap(use, capacity);
+    ia->summary = array_alloc_bitmap_summary(use, capacity);
+    if (!ia->occupancy || !ia->summary) {
+        if (ia->occupancy) coll_free(use, ia->occupancy);
+        if (ia->summary) coll_free(use, ia->summary);
+        collection_dispose(ia->coll);
+        goto cleanup;
+    }
+
     ia->next_slot = 0;
+    ia->generations = NULL;
+    ia->clear_generation = 0;
+    ia->live = 0;
+    ia->use = use;
     return ia;
 
 cleanup:
-    Allocator.dispose(ia);
+    coll_free(use, ia);
     ia = NULL;
 
 exit:
@@ -106,8 +214,13 @@ static void indexarray_dispose(indexarray ia) {
     if (!ia) {
         return;
     }
+    if (ia->generations) {
+        coll_free(ia->use, ia->generations);
+    }
+    coll_free(ia->use, ia->occupancy);
+    coll_free(ia->use, ia->summary);
     collection_dispose(ia->coll);
-    Allocator.dispose(ia);
+    coll_free(ia->use, ia);
 }
 
 // Add a value to the indexarray
@@ -120,38 +233,37 @@ static int indexarray_add(indexarray ia, object value) {
     usize capacity = indexarray_capacity(ia);
     void *buffer = collection_get_buffer(ia->coll);
 
-    // Try to find an empty slot starting from next_slot
-    for (usize i = 0; i < capacity; i++) {
-        usize slot_index = (ia->next_slot + i) % capacity;
-        void *slot = (char *)buffer + slot_index * stride;
-
-        if (is_slot_empty(slot, stride)) {
-            // Found empty slot, copy value
-            memcpy(slot, value, stride);
-            ia->next_slot = (slot_index + 1) % capacity;
-            return (int)slot_index;
+    // Find the first free slot at or after next_slot, wrapping once; the summary skips
+    // full words 64 (level 1) or 4096 (level 2) slots at a time
+    usize slot_index = capacity;
+    if (capacity) {
+        usize start = ia->next_slot % capacity;
+        slot_index = indexarray_next_free(ia, capacity, start);
+        if (slot_index == capacity && start) {
+            slot_index = indexarray_next_free(ia, capacity, 0);
         }
     }
+    if (slot_index < capacity) {
+        array_kernel_copy((char *)buffer + slot_index * stride, value, stride);
+        BITMAP_SET(ia->occupancy, slot_index);
+        indexarray_occupancy_changed(ia, slot_index, 1);
+        ia->live++;
+        ia->next_slot = (slot_index + 1) % capacity;
+        return (int)slot_index;
+    }
 
-    // No empty slot found - need to grow
-    if (collection_grow(ia->coll) != OK) {
+    // No empty slot found - need to grow; the first new slot takes the value
+    if (indexarray_grow(ia) != OK) {
         return ERR;
     }
-
-    // After growth, buffer and capacity change
     buffer = collection_get_buffer(ia->coll);
-    capacity = indexarray_capacity(ia);
+    array_kernel_copy((char *)buffer + capacity * stride, value, stride);
+    BITMAP_SET(ia->occupancy, capacity);
+    indexarray_occupancy_changed(ia, capacity, 1);
+    ia->live++;
+    ia->next_slot = capacity + 1;
 
-    // Zero out new space
-    void *new_space = (char *)buffer + (capacity / 2) * stride;
-    memset(new_space, 0, (capacity / 2) * stride);
-
-    // Add to first slot in new space
-    void *slot = (char *)buffer + (capacity / 2) * stride;
-    memcpy(slot, value, stride);
-    ia->next_slot = (capacity / 2) + 1;
-
-    return (int)(capacity / 2);
+    return (int)capacity;
 }
 
 // Get value at index
@@ -165,15 +277,13 @@ static int indexarray_get_at(indexarray ia, usize index, object out_value) {
         return ERR;
     }
 
-    usize stride = collection_get_stride(ia->coll);
-    void *buffer = collection_get_buffer(ia->coll);
-    void *slot = (char *)buffer + index * stride;
-
-    if (is_slot_empty(slot, stride)) {
+    if (indexarray_slot_empty(ia, index)) {
         return ERR;
     }
 
-    memcpy(out_value, slot, stride);
+    usize stride = collection_get_stride(ia->coll);
+    void *buffer = collection_get_buffer(ia->coll);
+    array_kernel_copy(out_value, (char *)buffer + index * stride, stride);
     return OK;
 }
 
@@ -192,13 +302,154 @@ static int indexarray_remove_at(indexarray ia, usize index) {
     void *buffer = collection_get_buffer(ia->coll);
     void *slot = (char *)buffer + index * stride;
 
+    if (!indexarray_slot_empty(ia, index)) {
+        if (ia->generations) {
+            ia->generations[index]++;  // retire outstanding handles to this slot
+        }
+        BITMAP_CLEAR(ia->occupancy, index);
+        indexarray_occupancy_changed(ia, index, 1);
+        ia->live--;
+    }
     zero_slot(slot, stride);
     return OK;
 }
 
-// Create from farray
+// Add a value and return a generational handle to its slot
+static sc_handle indexarray_add_handle(indexarray ia, object value) {
+    if (!ia) {
+        return SC_HANDLE_NULL;
+    }
+    if (indexarray_generations_ensure(ia) != OK) {
+        return SC_HANDLE_NULL;
+    }
+    int index = indexarray_add(ia, value);
+    if (index < 0) {
+        return SC_HANDLE_NULL;
+    }
+    return SC_HANDLE_MAKE(index, ia->generations[index] + ia->clear_generation);
+}
+
+// Get value behind a handle; stale handles fail on the generation compare
+static int indexarray_get_handle(indexarray ia, sc_handle handle, object out_value) {
+    if (!ia ||
+        array_check_generation(ia->generations, ia->clear_generation, indexarray_capacity(ia),
+                               handle) != OK) {
+        return ERR;
+    }
+    return indexarray_get_at(ia, SC_HANDLE_INDEX(handle), out_value);
+}
+
+// Remove value behind a handle, invalidating the handle
+static int indexarray_remove_handle(indexarray ia, sc_handle handle) {
+    if (!ia ||
+        array_check_generation(ia->generations, ia->clear_generation, indexarray_capacity(ia),
+                               handle) != OK) {
+        return ERR;
+    }
+    usize index = SC_HANDLE_INDEX(handle);
+    if (indexarray_is_empty_slot(ia, index)) {
+        return ERR;  // already removed via remove_at
+    }
+    return indexarray_remove_at(ia, index);
+}
+
+// Helper: copy values into free slots of [from, to); contiguous free runs take one memcpy
+static usize indexarray_fill_range(indexarray ia, usize from, usize to, const char *src, usize n,
+                                   sc_handle *handles_out) {
+    usize stride = collection_get_stride(ia->coll);
+    char *buffer = collection_get_buffer(ia->coll);
+    usize added = 0;
+    usize i = from;
+
+    while (added < n) {
+        i = indexarray_next_free(ia, indexarray_capacity(ia), i);
+        if (i >= to) {
+            break;
+        }
+        usize run = 0;
+        while (i + run < to && added + run < n && indexarray_slot_empty(ia, i + run)) {
+            run++;
+        }
+
+        memcpy(buffer + i * stride, src + added * stride, run * stride);
+        for (usize k = 0; k < run; k++) {
+            BITMAP_SET(ia->occupancy, i + k);
+            if (handles_out) {
+                handles_out[added + k] =
+                    SC_HANDLE_MAKE(i + k, ia->generations[i + k] + ia->clear_generation);
+            }
+        }
+        indexarray_occupancy_changed(ia, i, run);
+        added += run;
+        i += run;
+        ia->next_slot = i;
+    }
+    return added;
+}
+
+// Add n values packed at stride; handles_out (optional) receives a handle per added value
+static int indexarray_add_many(indexarray ia, const void *values, usize n,
+                               sc_handle *handles_out) {
+    if (!ia || (n && !values) || n > (usize)INT_MAX) {
+        return ERR;
+    }
+    if (handles_out && indexarray_generations_ensure(ia) != OK) {
+        return ERR;
+    }
+
+    // reserve room for the whole batch, then claim slots in one sweep from next_slot
+    while (indexarray_capacity(ia) - ia->live < n && indexarray_grow(ia) == OK) {
+    }
+    usize capacity = indexarray_capacity(ia);
+    usize start = capacity ? ia->next_slot % capacity : 0;
+    const char *src = values;
+    usize stride = collection_get_stride(ia->coll);
+
+    usize added = indexarray_fill_range(ia, start, capacity, src, n, handles_out);
+    if (added < n) {
+        added += indexarray_fill_range(ia, 0, start, src + added * stride, n - added,
+                                       handles_out ? handles_out + added : NULL);
+    }
+    ia->live += added;
+    if (capacity) {
+        ia->next_slot %= capacity;
+    }
+    return (int)added;
+}
+
+// Remove the values behind n handles; stale handles are skipped
+static int indexarray_remove_many(indexarray ia, const sc_handle *handles, usize n) {
+    if (!ia || (n && !handles) || n > (usize)INT_MAX) {
+        return ERR;
+    }
+    usize capacity = indexarray_capacity(ia);
+    usize stride = collection_get_stride(ia->coll);
+    char *buffer = collection_get_buffer(ia->coll);
+    usize removed = 0;
+
+    for (usize i = 0; i < n; i++) {
+        if (array_check_generation(ia->generations, ia->clear_generation, capacity, handles[i]) !=
+            OK) {
+            continue;
+        }
+        usize index = SC_HANDLE_INDEX(handles[i]);
+        if (indexarray_slot_empty(ia, index)) {
+            continue;  // already removed via remove_at
+        }
+        ia->generations[index]++;
+        BITMAP_CLEAR(ia->occupancy, index);
+        indexarray_occupancy_changed(ia, index, 1);
+        zero_slot(buffer + index * stride, stride);
+        removed++;
+    }
+    ia->live -= removed;
+    return (int)removed;
+}
+
+// Create from farray in one streaming pass: runs of non-empty elements are packed to the
+// front with one memcpy each and marked live in the same pass; nothing is allocated per element
 static indexarray indexarray_from_farray(farray arr, usize stride) {
-    if (!arr) {
+    if (!arr || stride == 0) {
         return NULL;
     }
 
@@ -208,25 +459,66 @@ static indexarray indexarray_from_farray(farray arr, usize stride) {
         return NULL;
     }
 
-    // Copy non-empty elements
-    for (usize i = 0; i < cap; i++) {
-        void *value = Allocator.alloc(stride);
-        if (!value) {
-            IndexArray.dispose(ia);
-            return NULL;
+    farray_epoch_sync(arr, stride);  // stale epoch slots must read as zero
+    const char *src = farray_get_bucket(arr);
+    char *dst = collection_get_buffer(ia->coll);
+    usize live = 0;
+    usize i = 0;
+    while (i < cap) {
+        if (is_slot_empty((object)(src + i * stride), stride)) {
+            i++;
+            continue;
         }
-
-        if (FArray.get(arr, i, stride, value) == OK) {
-            if (!is_slot_empty(value, stride)) {
-                IndexArray.add(ia, value);
-            }
+        usize run = 1;
+        while (i + run < cap && !is_slot_empty((object)(src + (i + run) * stride), stride)) {
+            run++;
         }
-        Allocator.dispose(value);
+        memcpy(dst + live * stride, src + i * stride, run * stride);
+        array_bitmap_set_range(ia->occupancy, live, run);
+        live += run;
+        i += run;
     }
 
+    array_bitmap_summary_rebuild(ia->summary, ia->occupancy, cap);
+    ia->live = live;
+    ia->next_slot = cap ? live % cap : 0;
     return ia;
 }
 
+// Copy live values, packed in slot order, into a caller buffer; contiguous live runs are
+// found with ctz over the bitmap and copied with one memcpy each
+static usize indexarray_export_values(indexarray ia, void *dst, usize max_count) {
+    if (!ia || !dst) {
+        return 0;
+    }
+    usize capacity = indexarray_capacity(ia);
+    usize stride = collection_get_stride(ia->coll);
+    const char *src = collection_get_buffer(ia->coll);
+    char *out = dst;
+    usize copied = 0;
+    usize i = 0;
+
+    while (copied < max_count && i < capacity) {
+        // skip empty slots a word at a time, then measure the live run
+        while (i < capacity && !BITMAP_TEST(ia->occupancy, i)) {
+            uint64_t word = ia->occupancy[i >> 6] >> (i & 63);
+            i += word ? (usize)__builtin_ctzll(word) : 64 - (i & 63);
+        }
+        if (i >= capacity) {
+            break;
+        }
+        usize end = array_bitmap_next_clear(ia->occupancy, capacity, i);
+        usize run = end - i;
+        if (run > max_count - copied) {
+            run = max_count - copied;
+        }
+        memcpy(out + copied * stride, src + i * stride, run * stride);
+        copied += run;
+        i += run;
+    }
+    return copied;
+}
+
 // Create from raw buffer range (non-owning view)
 static indexarray indexarray_from_buffer(void *buffer, void *end, usize stride) {
     indexarray ia = NULL;
@@ -235,13 +527,13 @@ static indexarray indexarray_from_buffer(void *buffer, void *end, usize stride)
         goto exit;
     }
 
-    ia = Allocator.alloc(sizeof(struct sc_indexarray));
+    ia = coll_alloc(NULL, sizeof(struct sc_indexarray));
     if (!ia) {
         goto exit;
     }
 
     // Create a non-owning collection view of the buffer
-    ia->coll = Allocator.alloc(sizeof(struct sc_collection));
+    ia->coll = coll_alloc(NULL, sizeof(struct sc_collection));
     if (!ia->coll) {
         goto cleanup;
     }
@@ -253,12 +545,29 @@ static indexarray indexarray_from_buffer(void *buffer, void *end, usize stride)
     ia->coll->stride = stride;
     ia->coll->length = 0;           // Length not used for sparse arrays
     ia->coll->owns_buffer = false;  // Non-owning view
+    ia->coll->headed_bucket = false;
+    ia->coll->read_only = false;
+    ia->coll->use = NULL;
 
     ia->next_slot = 0;
+    ia->generations = NULL;
+    ia->clear_generation = 0;
+    ia->use = NULL;
+
+    // the caller's buffer may already hold live slots
+    ia->occupancy = array_alloc_bitmap(NULL, indexarray_capacity(ia));
+    ia->summary = array_alloc_bitmap_summary(NULL, indexarray_capacity(ia));
+    if (!ia->occupancy || !ia->summary) {
+        if (ia->occupancy) coll_free(NULL, ia->occupancy);
+        if (ia->summary) coll_free(NULL, ia->summary);
+        coll_free(NULL, ia->coll);
+        goto cleanup;
+    }
+    indexarray_recount(ia);
     return ia;
 
 cleanup:
-    Allocator.dispose(ia);
+    coll_free(NULL, ia);
     ia = NULL;
 
 exit:
@@ -276,11 +585,7 @@ static bool indexarray_is_empty_slot(indexarray ia, usize index) {
         return true;
     }
 
-    usize stride = collection_get_stride(ia->coll);
-    void *buffer = collection_get_buffer(ia->coll);
-    void *slot = (char *)buffer + index * stride;
-
-    return is_slot_empty(slot, stride);
+    return indexarray_slot_empty(ia, index);
 }
 
 // Get capacity
@@ -307,6 +612,110 @@ static usize indexarray_stride(indexarray ia) {
     return collection_get_stride(ia->coll);
 }
 
+// Pack live slots to the front; remap (optional) receives old index -> new index (-1 if empty)
+static int indexarray_compact(indexarray ia, farray *remap) {
+    if (!ia) {
+        return ERR;
+    }
+    usize capacity = indexarray_capacity(ia);
+    usize stride = collection_get_stride(ia->coll);
+    char *buffer = collection_get_buffer(ia->coll);
+    int *table = NULL;
+    if (remap) {
+        *remap = FArray.new_with(ia->use, capacity ? capacity : 1, sizeof(int));
+        if (!*remap) {
+            return ERR;
+        }
+        table = farray_get_bucket(*remap);
+    }
+
+    usize live = 0;
+    for (usize i = 0; i < capacity; i++) {
+        if (indexarray_slot_empty(ia, i)) {
+            if (table) table[i] = ERR;
+            continue;
+        }
+        if (i != live) {
+            char *slot = buffer + i * stride;
+            memcpy(buffer + live * stride, slot, stride);
+            zero_slot(slot, stride);
+            if (ia->generations) {
+                // both slots changed contents: retire handles to either index
+                ia->generations[live]++;
+                ia->generations[i]++;
+            }
+        }
+        if (table) table[i] = (int)live;
+        live++;
+    }
+
+    // live slots now occupy exactly [0, live)
+    array_bitmap_reset(ia->occupancy, capacity);
+    array_bitmap_set_range(ia->occupancy, 0, live);
+    array_bitmap_summary_rebuild(ia->summary, ia->occupancy, capacity);
+    ia->next_slot = live < capacity ? live : 0;
+    return (int)live;
+}
+
+// Release trailing empty slots (capacity never drops below 1)
+static int indexarray_shrink_to_fit(indexarray ia) {
+    if (!ia) {
+        return ERR;
+    }
+    usize capacity = indexarray_capacity(ia);
+    usize new_capacity = capacity;
+    while (new_capacity > 1 && indexarray_is_empty_slot(ia, new_capacity - 1)) {
+        new_capacity--;
+    }
+    if (new_capacity == capacity) {
+        return OK;
+    }
+    if (collection_resize(ia->coll, new_capacity) != OK) {
+        return ERR;  // includes non-owning views from from_buffer
+    }
+
+    // side tables may stay oversized if shrinking them fails; they only need to cover capacity
+    if (ia->generations) {
+        array_resize_epochs(ia->use, &ia->generations, capacity, new_capacity);
+    }
+    if (array_resize_bitmap(ia->use, &ia->occupancy, capacity, new_capacity) != OK ||
+        array_resize_bitmap_summary(ia->use, &ia->summary, ia->occupancy, new_capacity) != OK) {
+        // the oversized summary is still laid out for the old capacity
+        array_bitmap_summary_rebuild(ia->summary, ia->occupancy, new_capacity);
+    }
+    if (ia->next_slot >= new_capacity) {
+        ia->next_slot = 0;
+    }
+    return OK;
+}
+
+// Number of occupied slots, tracked incrementally
+static usize indexarray_count(indexarray ia) {
+    return ia ? ia->live : 0;
+}
+
+// Occupied slots / capacity (0 for an empty-capacity indexarray)
+static double indexarray_fill_ratio(indexarray ia) {
+    usize capacity = indexarray_capacity(ia);
+    return capacity ? (double)ia->live / (double)capacity : 0.0;
+}
+
+// Longest run of consecutive empty slots, O(capacity / 64)
+static usize indexarray_largest_free_run(indexarray ia) {
+    if (!ia) {
+        return 0;
+    }
+    return array_bitmap_largest_free_run(ia->occupancy, indexarray_capacity(ia));
+}
+
+// 1 - largest_free_run / free slots: 0 when free space is contiguous, near 1 when scattered
+static double indexarray_fragmentation(indexarray ia) {
+    if (!ia) {
+        return 0.0;
+    }
+    return array_bitmap_fragmentation(ia->occupancy, indexarray_capacity(ia), ia->live);
+}
+
 // Clear all slots
 static void indexarray_clear(indexarray ia) {
     if (!ia) {
@@ -317,10 +726,16 @@ static void indexarray_clear(indexarray ia) {
     usize stride = collection_get_stride(ia->coll);
     void *buffer = collection_get_buffer(ia->coll);
 
-    if (buffer) {
+    ia->next_slot = 0;
+    ia->live = 0;
+    ia->clear_generation++;  // retires every outstanding handle in O(1)
+    array_bitmap_reset(ia->occupancy, capacity);
+    array_bitmap_summary_rebuild(ia->summary, ia->occupancy, capacity);
+    // the bitmap alone says every slot is empty; stale bytes are overwritten by the next add.
+    // a view's buffer is zeroed since a later from_buffer can only infer occupancy from it
+    if (buffer && !ia->coll->owns_buffer) {
         memset(buffer, 0, capacity * stride);
     }
-    ia->next_slot = 0;
 }
 
 // Internal ops table for sparse iterator interface
@@ -334,21 +749,34 @@ static sparse_iterator indexarray_create_iterator(indexarray ia) {
     if (!ia) {
         return NULL;
     }
-    return sparse_iterator_new(ia, &indexarray_sparse_ops);
+    return sparse_iterator_new(ia->use, ia, &indexarray_sparse_ops);
 }
 
 // Public interface implementation
 const sc_indexarray_i IndexArray = {
     .new = indexarray_new,
+    .new_with = indexarray_new_with,
     .dispose = indexarray_dispose,
     .add = indexarray_add,
     .get_at = indexarray_get_at,
     .remove_at = indexarray_remove_at,
+    .add_handle = indexarray_add_handle,
+    .get_handle = indexarray_get_handle,
+    .remove_handle = indexarray_remove_handle,
+    .add_many = indexarray_add_many,
+    .remove_many = indexarray_remove_many,
     .from_farray = indexarray_from_farray,
+    .export_values = indexarray_export_values,
     .from_buffer = indexarray_from_buffer,
     .is_empty_slot = indexarray_is_empty_slot,
     .capacity = indexarray_capacity,
     .stride = indexarray_stride,
     .clear = indexarray_clear,
+    .count = indexarray_count,
+    .fill_ratio = indexarray_fill_ratio,
+    .largest_free_run = indexarray_largest_free_run,
+    .fragmentation = indexarray_fragmentation,
+    .compact = indexarray_compact,
+    .shrink_to_fit = indexarray_shrink_to_fit,
     .create_iterator = indexarray_create_iterator,
 };
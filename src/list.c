@@ -39,23 +39,29 @@
 
 //  declare the List struct: derived from Collection
 struct sc_list {
-    collection coll;  // underlying collection
+    collection coll;      // underlying collection
+    sc_alloc_use_t *use;  // instance allocator (NULL = Allocator facade)
 };
 
+static list list_new_with(sc_alloc_use_t *use, usize capacity, usize stride);
+
 //  create new list with specified initial capacity and stride
-static list list_new(usize capacity, usize stride) {
+static list list_new(usize capacity, usize stride) { return list_new_with(NULL, capacity, stride); }
+//  create new list whose allocations all go through the given allocator
+static list list_new_with(sc_alloc_use_t *use, usize capacity, usize stride) {
     //  allocate memory for the list structure
-    struct sc_list *lst = Allocator.alloc(sizeof(struct sc_list));
+    struct sc_list *lst = coll_alloc(use, sizeof(struct sc_list));
     if (!lst) {
         return NULL;  // allocation ERRed
     }
 
     //  create the underlying collection with the specified stride
-    lst->coll = collection_new(capacity, stride);
+    lst->coll = collection_new(use, capacity, stride);
     if (!lst->coll) {
-        Allocator.dispose(lst);
+        coll_free(use, lst);
         return NULL;  // allocation ERRed
     }
+    lst->use = use;
 
     // Collections store pointers for reference semantics
     // lst->coll->array.handle[0] = 'F';
@@ -72,7 +78,7 @@ static void list_dispose(list lst) {
     collection_dispose(lst->coll);
 
     //  free the list structure itself
-    Allocator.dispose(lst);
+    coll_free(lst->use, lst);
 }
 
 //  get the current capacity of the list
@@ -194,6 +200,7 @@ static void list_clear(list lst) {
 //  public interface implementation
 const sc_list_i List = {
     .new = list_new,
+    .new_with = list_new_with,
     .dispose = list_dispose,
     .capacity = list_capacity,
     .size = list_size,
@@ -35,6 +35,7 @@
 
 // Forward declarations - API functions
 static map map_new(usize capacity);
+static map map_new_with(sc_alloc_use_t *use, usize capacity);
 static void map_init(map *m, usize capacity);
 static void map_dispose(map m);
 static int map_set(map m, const char *key, usize len, usize val);
@@ -50,6 +51,7 @@ static uint64_t fnv1a_hash(const char *data, usize len);
 static usize next_power_of_two(usize n);
 static int map_resize(map m, usize new_capacity);
 static int map_find_slot(map m, const char *key, usize len, uint64_t hash, usize *out_idx);
+static void map_init_with(map m, sc_alloc_use_t *use, usize capacity);
 
 // Forward declarations - sparse iterator helpers
 static bool map_is_empty_slot(map m, usize index);
@@ -72,6 +74,7 @@ struct sc_map_s {
     farray buckets;  // FArray of map_bucket structs
     usize count;     // Number of occupied slots (excludes tombstones)
     usize capacity;  // Current bucket capacity (cached from FArray)
+    sc_alloc_use_t *use;  // Instance allocator (NULL = Allocator facade)
 };
 
 // Sparse iterator operations for Map
@@ -84,6 +87,7 @@ static const sc_sparse_i map_sparse_ops = {
 // API interface definition
 const sc_map_i Map = {
     .new = map_new,
+    .new_with = map_new_with,
     .init = map_init,
     .dispose = map_dispose,
     .set = map_set,
@@ -188,7 +192,7 @@ static int map_resize(map m, usize new_capacity) {
     usize old_capacity = m->capacity;
 
     // Create new bucket array
-    m->buckets = FArray.new(new_capacity, stride);
+    m->buckets = FArray.new_with(m->use, new_capacity, stride);
     if (!m->buckets) {
         m->buckets = old_buckets;  // Restore on failure
         return ERR;
@@ -228,21 +232,30 @@ static int map_resize(map m, usize new_capacity) {
 /**
  * @brief Create a new map
  */
-static map map_new(usize capacity) {
-    map m = Allocator.alloc(sizeof(struct sc_map_s));
+static map map_new(usize capacity) { return map_new_with(NULL, capacity); }
+
+/**
+ * @brief Create a new map whose struct, buckets, rehashes and iterators use the given allocator
+ */
+static map map_new_with(sc_alloc_use_t *use, usize capacity) {
+    map m = coll_alloc(use, sizeof(struct sc_map_s));
     if (!m) {
         return NULL;
     }
 
-    map_init(&m, capacity);
+    map_init_with(m, use, capacity);
     return m;
 }
 
 /**
  * @brief Initialize map in-place
  */
-static void map_init(map *m_ptr, usize capacity) {
-    map m = *m_ptr;
+static void map_init(map *m_ptr, usize capacity) { map_init_with(*m_ptr, NULL, capacity); }
+
+/**
+ * @brief Initialize map in-place, binding the instance allocator
+ */
+static void map_init_with(map m, sc_alloc_use_t *use, usize capacity) {
     usize stride = sizeof(map_bucket);
 
     // Round up to power of 2, minimum 8
@@ -251,7 +264,8 @@ static void map_init(map *m_ptr, usize capacity) {
         capacity = 8;
     }
 
-    m->buckets = FArray.new(capacity, stride);
+    m->use = use;
+    m->buckets = FArray.new_with(use, capacity, stride);
     m->count = 0;
     m->capacity = capacity;
 
@@ -274,7 +288,7 @@ static void map_dispose(map m) {
         FArray.dispose(m->buckets);
     }
 
-    Allocator.dispose(m);
+    coll_free(m->use, m);
 }
 
 /**
@@ -431,5 +445,5 @@ static sparse_iterator map_create_iterator(map m) {
     if (!m) {
         return NULL;
     }
-    return sparse_iterator_new(m, &map_sparse_ops);
+    return sparse_iterator_new(m->use, m, &map_sparse_ops);
 }
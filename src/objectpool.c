@@ -0,0 +1,425 @@
+/*
+ * Sigma Collections
+ * Copyright (c) 2026 David Boarman (BadKraft) and contributors
+ * QuantumOverride [Q|]
+ * ----------------------------------------------
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * ----------------------------------------------
+ * File: objectpool.c
+ * Description: Implementation of ObjectPool - slab-backed fixed-size object allocation
+ */
+
+#include "objectpool.h"
+#include <sigma.core/allocator.h>
+#include <string.h>
+#include "internal/arrays.h"
+#include "internal/collections.h"
+#include "slotarray.h"
+
+#define POOL_DEFAULT_PER_SLAB 64
+#define POOL_BLOCK_ALIGN 16
+#define POOL_ALIGN_UP(n) (((n) + POOL_BLOCK_ALIGN - 1) & ~(usize)(POOL_BLOCK_ALIGN - 1))
+
+// one slab: header, occupancy bits, then per_slab blocks of one object each
+typedef struct pool_slab pool_slab;
+struct pool_slab {
+    pool_slab *prev;       // partial list links (slabs with at least one vacant block)
+    pool_slab *next;
+    object free_list;      // first vacant object; each vacant object stores the next
+    usize live;            // acquired objects in this slab
+    usize id;              // slot in the pool's slab table
+    bool in_partial;       // linked into the pool's partial list
+    char *blocks;          // first block
+    uint64_t occupancy[];  // one bit per block (set = acquired)
+};
+
+// ObjectPool struct: slab table plus a list of slabs that still have room
+struct sc_objectpool {
+    slotarray slabs;       // slab table: slot index = slab id
+    pool_slab **by_addr;   // live slabs sorted by address; release looks pointers up here
+    usize by_addr_count;   // entries in by_addr (one per live slab)
+    usize by_addr_capacity;
+    pool_slab *partial;    // slabs with vacant blocks; acquire uses the head
+    usize object_size;     // caller's object size
+    usize block_size;      // object rounded to POOL_BLOCK_ALIGN
+    usize per_slab;        // blocks per slab
+    usize live;            // acquired objects across all slabs
+    bool release_empty;    // free a slab when its last object is released
+    sc_alloc_use_t *use;   // instance allocator (NULL = Allocator facade)
+};
+
+// Forward declarations
+static objectpool pool_new(usize object_size, usize per_slab);
+static objectpool pool_new_with(sc_alloc_use_t *use, usize object_size, usize per_slab);
+static void pool_dispose(objectpool pool);
+
+// Helper functions
+static pool_slab *pool_slab_new(objectpool pool);
+static void pool_slab_free(objectpool pool, pool_slab *slab);
+static void pool_partial_link(objectpool pool, pool_slab *slab);
+static void pool_partial_unlink(objectpool pool, pool_slab *slab);
+static usize pool_block_index(objectpool pool, pool_slab *slab, object obj);
+static usize pool_by_addr_upper(objectpool pool, uintptr_t at);
+static pool_slab *pool_slab_of(objectpool pool, object obj);
+
+// Create new object pool
+static objectpool pool_new(usize object_size, usize per_slab) {
+    return pool_new_with(NULL, object_size, per_slab);
+}
+
+// Create new object pool whose slabs use the given allocator
+static objectpool pool_new_with(sc_alloc_use_t *use, usize object_size, usize per_slab) {
+    objectpool pool = NULL;
+
+    if (object_size == 0 || object_size > SIZE_MAX / 2) {
+        goto exit;
+    }
+
+    pool = coll_alloc(use, sizeof(struct sc_objectpool));
+    if (!pool) {
+        goto exit;
+    }
+
+    pool->slabs = SlotArray.new_with(use, 4);
+    if (!pool->slabs) {
+        goto cleanup;
+    }
+    pool->by_addr = NULL;
+    pool->by_addr_count = 0;
+    pool->by_addr_capacity = 0;
+    pool->partial = NULL;
+    pool->object_size = object_size;
+    // vacant blocks hold the free-list link in the object bytes
+    usize payload = object_size < sizeof(object) ? sizeof(object) : object_size;
+    pool->block_size = POOL_ALIGN_UP(payload);
+    pool->per_slab = per_slab ? per_slab : POOL_DEFAULT_PER_SLAB;
+    pool->live = 0;
+    pool->release_empty = false;
+    pool->use = use;
+    goto exit;
+
+cleanup:
+    coll_free(use, pool);
+    pool = NULL;
+
+exit:
+    return pool;
+}
+
+// Dispose of the pool and every slab
+static void pool_dispose(objectpool pool) {
+    if (!pool) {
+        return;
+    }
+    usize capacity = SlotArray.capacity(pool->slabs);
+    for (usize id = 0; id < capacity; id++) {
+        object slab;
+        if (SlotArray.get_at(pool->slabs, id, &slab) == OK) {
+            coll_free(pool->use, slab);
+        }
+    }
+    SlotArray.dispose(pool->slabs);
+    if (pool->by_addr) {
+        coll_free(pool->use, pool->by_addr);
+    }
+    coll_free(pool->use, pool);
+}
+
+// Pop a vacant object from the first slab with room
+static object pool_acquire(objectpool pool) {
+    if (!pool) {
+        return NULL;
+    }
+    pool_slab *slab = pool->partial;
+    if (!slab) {
+        slab = pool_slab_new(pool);
+        if (!slab) {
+            return NULL;
+        }
+    }
+
+    object obj = slab->free_list;
+    slab->free_list = *(object *)obj;
+    if (!slab->free_list) {
+        pool_partial_unlink(pool, slab);  // slab is now full
+    }
+    BITMAP_SET(slab->occupancy, pool_block_index(pool, slab, obj));
+    slab->live++;
+    pool->live++;
+
+    memset(obj, 0, pool->object_size);
+    return obj;
+}
+
+// Push an object back on its slab's free list
+static int pool_release(objectpool pool, object obj) {
+    if (!pool || !obj) {
+        return ERR;
+    }
+    // nothing is read through obj until it is known to lie in one of this pool's live slabs
+    pool_slab *slab = pool_slab_of(pool, obj);
+    if (!slab) {
+        return ERR;  // foreign pointer, or its slab has already been released
+    }
+    usize index = pool_block_index(pool, slab, obj);
+    if (index >= pool->per_slab || !BITMAP_TEST(slab->occupancy, index)) {
+        return ERR;  // not an acquired object of this pool
+    }
+
+    BITMAP_CLEAR(slab->occupancy, index);
+    *(object *)obj = slab->free_list;
+    slab->free_list = obj;
+    if (!slab->in_partial) {
+        pool_partial_link(pool, slab);
+    }
+    slab->live--;
+    pool->live--;
+
+    if (slab->live == 0 && pool->release_empty && SlotArray.count(pool->slabs) > 1) {
+        pool_slab_free(pool, slab);
+    }
+    return OK;
+}
+
+// Toggle releasing slabs when they empty
+static void pool_set_release_empty(objectpool pool, bool enabled) {
+    if (pool) {
+        pool->release_empty = enabled;
+    }
+}
+
+// Release every slab with no live objects
+static usize pool_trim(objectpool pool) {
+    if (!pool) {
+        return 0;
+    }
+    usize released = 0;
+    usize capacity = SlotArray.capacity(pool->slabs);
+    for (usize id = 0; id < capacity; id++) {
+        object slab;
+        if (SlotArray.get_at(pool->slabs, id, &slab) == OK && ((pool_slab *)slab)->live == 0) {
+            pool_slab_free(pool, slab);
+            released++;
+        }
+    }
+    return released;
+}
+
+// Live objects
+static usize pool_count(objectpool pool) {
+    return pool ? pool->live : 0;
+}
+
+// Objects across allocated slabs
+static usize pool_capacity(objectpool pool) {
+    return pool ? SlotArray.count(pool->slabs) * pool->per_slab : 0;
+}
+
+// Allocated slabs
+static usize pool_slab_count(objectpool pool) {
+    return pool ? SlotArray.count(pool->slabs) : 0;
+}
+
+// Iterator index space: slab id * per_slab + block index
+static usize pool_iter_capacity(objectpool pool) {
+    return SlotArray.capacity(pool->slabs) * pool->per_slab;
+}
+
+// Object pointer at an iterator index, or NULL if the block is vacant
+static object pool_iter_object(objectpool pool, usize index) {
+    object slab;
+    if (SlotArray.get_at(pool->slabs, index / pool->per_slab, &slab) != OK) {
+        return NULL;  // slab was released
+    }
+    usize block = index % pool->per_slab;
+    if (!BITMAP_TEST(((pool_slab *)slab)->occupancy, block)) {
+        return NULL;
+    }
+    return ((pool_slab *)slab)->blocks + block * pool->block_size;
+}
+
+static bool pool_iter_is_empty(objectpool pool, usize index) {
+    return pool_iter_object(pool, index) == NULL;
+}
+
+static int pool_iter_get_at(objectpool pool, usize index, object *out_value) {
+    object obj = pool_iter_object(pool, index);
+    if (!obj || !out_value) {
+        return ERR;
+    }
+    *out_value = obj;
+    return OK;
+}
+
+// Internal ops table for sparse iterator interface
+static const sc_sparse_i pool_sparse_ops = {
+    .is_empty_slot = (bool (*)(object, usize))pool_iter_is_empty,
+    .capacity = (usize (*)(object))pool_iter_capacity,
+    .get_at = (int (*)(object, usize, object *))pool_iter_get_at};
+
+// Create sparse iterator over live objects
+static sparse_iterator pool_create_iterator(objectpool pool) {
+    if (!pool) {
+        return NULL;
+    }
+    return sparse_iterator_new(pool->use, pool, &pool_sparse_ops);
+}
+
+// Allocate a slab, thread its blocks onto a free list and make it the partial head
+static pool_slab *pool_slab_new(objectpool pool) {
+    usize words = BITMAP_WORDS(pool->per_slab);
+    usize header = POOL_ALIGN_UP(sizeof(pool_slab) + sizeof(uint64_t) * words);
+    if (pool->per_slab > (SIZE_MAX - header) / pool->block_size) {
+        return NULL;
+    }
+
+    // make room in the address table first so a registered slab is always findable
+    if (pool->by_addr_count == pool->by_addr_capacity) {
+        usize capacity = pool->by_addr_capacity ? pool->by_addr_capacity * 2 : 4;
+        pool_slab **grown = coll_realloc(pool->use, pool->by_addr,
+                                         sizeof(pool_slab *) * pool->by_addr_capacity,
+                                         sizeof(pool_slab *) * capacity);
+        if (!grown) {
+            return NULL;
+        }
+        pool->by_addr = grown;
+        pool->by_addr_capacity = capacity;
+    }
+
+    pool_slab *slab = coll_alloc(pool->use, header + pool->per_slab * pool->block_size);
+    if (!slab) {
+        return NULL;
+    }
+    int id = SlotArray.add(pool->slabs, slab);
+    if (id < 0) {
+        coll_free(pool->use, slab);
+        return NULL;
+    }
+    usize at = pool_by_addr_upper(pool, (uintptr_t)slab);
+    memmove(pool->by_addr + at + 1, pool->by_addr + at,
+            sizeof(pool_slab *) * (pool->by_addr_count - at));
+    pool->by_addr[at] = slab;
+    pool->by_addr_count++;
+
+    slab->id = (usize)id;
+    slab->live = 0;
+    slab->in_partial = false;
+    slab->blocks = (char *)slab + header;
+    memset(slab->occupancy, 0, sizeof(uint64_t) * words);
+
+    // link blocks in ascending order so objects are handed out front to back
+    object next = NULL;
+    for (usize i = pool->per_slab; i-- > 0;) {
+        object obj = slab->blocks + i * pool->block_size;
+        *(object *)obj = next;
+        next = obj;
+    }
+    slab->free_list = next;
+    pool_partial_link(pool, slab);
+    return slab;
+}
+
+// Unlink a slab from every structure and return it to the allocator
+static void pool_slab_free(objectpool pool, pool_slab *slab) {
+    if (slab->in_partial) {
+        pool_partial_unlink(pool, slab);
+    }
+    usize at = pool_by_addr_upper(pool, (uintptr_t)slab) - 1;  // slab itself is in the table
+    pool->by_addr_count--;
+    memmove(pool->by_addr + at, pool->by_addr + at + 1,
+            sizeof(pool_slab *) * (pool->by_addr_count - at));
+    SlotArray.remove_at(pool->slabs, slab->id);
+    coll_free(pool->use, slab);
+}
+
+static void pool_partial_link(objectpool pool, pool_slab *slab) {
+    slab->prev = NULL;
+    slab->next = pool->partial;
+    if (pool->partial) {
+        pool->partial->prev = slab;
+    }
+    pool->partial = slab;
+    slab->in_partial = true;
+}
+
+static void pool_partial_unlink(objectpool pool, pool_slab *slab) {
+    if (slab->prev) {
+        slab->prev->next = slab->next;
+    } else {
+        pool->partial = slab->next;
+    }
+    if (slab->next) {
+        slab->next->prev = slab->prev;
+    }
+    slab->prev = slab->next = NULL;
+    slab->in_partial = false;
+}
+
+// Block index of an object within its slab (per_slab if obj is not a block start)
+static usize pool_block_index(objectpool pool, pool_slab *slab, object obj) {
+    usize offset = (usize)((uintptr_t)obj - (uintptr_t)slab->blocks);
+    if (offset % pool->block_size) {
+        return pool->per_slab;
+    }
+    return offset / pool->block_size;
+}
+
+// Number of live slabs whose address is at or below `at` (binary search of by_addr)
+static usize pool_by_addr_upper(objectpool pool, uintptr_t at) {
+    usize lo = 0;
+    usize hi = pool->by_addr_count;
+    while (lo < hi) {
+        usize mid = lo + (hi - lo) / 2;
+        if ((uintptr_t)pool->by_addr[mid] <= at) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+// Live slab whose blocks contain obj, or NULL; never dereferences obj
+static pool_slab *pool_slab_of(objectpool pool, object obj) {
+    usize at = pool_by_addr_upper(pool, (uintptr_t)obj);
+    if (at == 0) {
+        return NULL;
+    }
+    pool_slab *slab = pool->by_addr[at - 1];
+    uintptr_t first = (uintptr_t)slab->blocks;
+    if ((uintptr_t)obj < first || (uintptr_t)obj - first >= pool->per_slab * pool->block_size) {
+        return NULL;
+    }
+    return slab;
+}
+
+// Public interface implementation
+const sc_objectpool_i ObjectPool = {
+    .new = pool_new,
+    .new_with = pool_new_with,
+    .dispose = pool_dispose,
+    .acquire = pool_acquire,
+    .release = pool_release,
+    .set_release_empty = pool_set_release_empty,
+    .trim = pool_trim,
+    .count = pool_count,
+    .capacity = pool_capacity,
+    .slab_count = pool_slab_count,
+    .create_iterator = pool_create_iterator,
+};
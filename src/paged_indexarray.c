@@ -0,0 +1,352 @@
+/*
+ * Sigma Collections
+ * Copyright (c) 2026 David Boarman (BadKraft) and contributors
+ * QuantumOverride [Q|]
+ * ----------------------------------------------
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * ----------------------------------------------
+ * File: paged_indexarray.c
+ * Description: Implementation of PagedIndexArray - indexarray over a page directory
+ */
+
+#include "paged_indexarray.h"
+#include <sigma.core/allocator.h>
+#include <limits.h>
+#include <string.h>
+#include "internal/arrays.h"
+#include "internal/collections.h"
+
+#define PAGED_DATA_ALIGN 64   // page data starts on a cache line
+#define PAGED_MIN_DIRECTORY 4 // directory entries allocated on first growth
+
+// one page: live count and occupancy bits, then per_page values
+typedef struct paged_page {
+    usize live;            // occupied slots on this page
+    char *data;            // per_page * stride bytes, PAGED_DATA_ALIGN aligned
+    uint64_t occupancy[];  // one bit per slot (set = live)
+} paged_page;
+
+// PagedIndexArray struct: directory of fixed-size pages
+struct sc_paged_indexarray {
+    paged_page **pages;     // page directory; NULL entries were never allocated or released
+    usize directory_size;   // entries in the directory
+    usize pages_live;       // allocated pages
+    usize per_page;         // slots per page (power of two)
+    usize page_shift;       // log2(per_page)
+    usize stride;           // element size in bytes
+    usize live;             // occupied slots across all pages
+    usize first_open;       // no page below this directory entry has a free slot
+    bool release_empty;     // free a page when its last value is removed
+    sc_alloc_use_t *use;    // instance allocator (NULL = Allocator facade)
+};
+
+// Forward declarations
+static paged_indexarray paged_new(usize stride, usize page_bytes);
+static paged_indexarray paged_new_with(sc_alloc_use_t *use, usize stride, usize page_bytes);
+static void paged_dispose(paged_indexarray pa);
+static usize paged_capacity(paged_indexarray pa);
+
+// Helper functions
+static paged_page *paged_page_new(paged_indexarray pa);
+static void paged_page_free(paged_indexarray pa, usize page);
+static int paged_directory_grow(paged_indexarray pa);
+static object paged_slot(paged_indexarray pa, usize index);
+
+// Create new paged indexarray
+static paged_indexarray paged_new(usize stride, usize page_bytes) {
+    return paged_new_with(NULL, stride, page_bytes);
+}
+
+// Create new paged indexarray whose pages use the given allocator
+static paged_indexarray paged_new_with(sc_alloc_use_t *use, usize stride, usize page_bytes) {
+    paged_indexarray pa = NULL;
+
+    if (stride == 0) {
+        goto exit;
+    }
+
+    pa = coll_alloc(use, sizeof(struct sc_paged_indexarray));
+    if (!pa) {
+        goto exit;
+    }
+    memset(pa, 0, sizeof(struct sc_paged_indexarray));
+    pa->stride = stride;
+    pa->use = use;
+
+    // largest power of two that fits the page (at least one slot)
+    usize slots = (page_bytes ? page_bytes : PAGED_DEFAULT_PAGE_BYTES) / stride;
+    if (slots > ((usize)INT_MAX + 1) / 2) {
+        slots = ((usize)INT_MAX + 1) / 2;
+    }
+    pa->page_shift = slots > 1 ? 63 - (usize)__builtin_clzll((unsigned long long)slots) : 0;
+    pa->per_page = (usize)1 << pa->page_shift;
+
+exit:
+    return pa;
+}
+
+// Dispose of the paged indexarray and every page
+static void paged_dispose(paged_indexarray pa) {
+    if (!pa) {
+        return;
+    }
+    for (usize p = 0; p < pa->directory_size; p++) {
+        if (pa->pages[p]) {
+            coll_free(pa->use, pa->pages[p]);
+        }
+    }
+    if (pa->pages) {
+        coll_free(pa->use, pa->pages);
+    }
+    coll_free(pa->use, pa);
+}
+
+// Copy a value into the lowest free slot; growth appends a page and moves nothing
+static int paged_add(paged_indexarray pa, object value) {
+    if (!pa || !value) {
+        return ERR;
+    }
+
+    usize p = pa->first_open;
+    while (p < pa->directory_size && pa->pages[p] && pa->pages[p]->live == pa->per_page) {
+        p++;
+    }
+    pa->first_open = p;
+    if (p == pa->directory_size && paged_directory_grow(pa) != OK) {
+        return ERR;
+    }
+    if (((p + 1) << pa->page_shift) - 1 > (usize)INT_MAX) {
+        return ERR;  // slot indices are returned as int
+    }
+    if (!pa->pages[p]) {
+        pa->pages[p] = paged_page_new(pa);
+        if (!pa->pages[p]) {
+            return ERR;
+        }
+        pa->pages_live++;
+    }
+
+    paged_page *page = pa->pages[p];
+    usize slot = array_bitmap_next_clear(page->occupancy, pa->per_page, 0);
+    memcpy(page->data + slot * pa->stride, value, pa->stride);
+    BITMAP_SET(page->occupancy, slot);
+    page->live++;
+    pa->live++;
+    return (int)((p << pa->page_shift) + slot);
+}
+
+// Copy out the value at a slot
+static int paged_get_at(paged_indexarray pa, usize index, object out_value) {
+    object slot = paged_slot(pa, index);
+    if (!slot || !out_value) {
+        return ERR;
+    }
+    memcpy(out_value, slot, pa->stride);
+    return OK;
+}
+
+// Stable pointer to the value at a slot
+static object paged_get_ptr(paged_indexarray pa, usize index) {
+    return paged_slot(pa, index);
+}
+
+// Remove the value at a slot; an emptied page may be released
+static int paged_remove_at(paged_indexarray pa, usize index) {
+    if (!pa || index >= paged_capacity(pa)) {
+        return ERR;
+    }
+    usize p = index >> pa->page_shift;
+    usize slot = index & (pa->per_page - 1);
+    paged_page *page = pa->pages[p];
+    if (!page || !BITMAP_TEST(page->occupancy, slot)) {
+        return OK;  // already empty
+    }
+
+    BITMAP_CLEAR(page->occupancy, slot);
+    page->live--;
+    pa->live--;
+    if (p < pa->first_open) {
+        pa->first_open = p;
+    }
+    if (page->live == 0 && pa->release_empty) {
+        paged_page_free(pa, p);
+    }
+    return OK;
+}
+
+// Toggle releasing pages when they empty
+static void paged_set_release_empty(paged_indexarray pa, bool enabled) {
+    if (pa) {
+        pa->release_empty = enabled;
+    }
+}
+
+// Release every allocated page with no live values
+static usize paged_trim(paged_indexarray pa) {
+    if (!pa) {
+        return 0;
+    }
+    usize released = 0;
+    for (usize p = 0; p < pa->directory_size; p++) {
+        if (pa->pages[p] && pa->pages[p]->live == 0) {
+            paged_page_free(pa, p);
+            released++;
+        }
+    }
+    return released;
+}
+
+// Check if slot is empty
+static bool paged_is_empty_slot(paged_indexarray pa, usize index) {
+    return paged_slot(pa, index) == NULL;
+}
+
+// Slots spanned by the directory
+static usize paged_capacity(paged_indexarray pa) {
+    return pa ? pa->directory_size << pa->page_shift : 0;
+}
+
+// Occupied slots
+static usize paged_count(paged_indexarray pa) {
+    return pa ? pa->live : 0;
+}
+
+// Allocated pages
+static usize paged_page_count(paged_indexarray pa) {
+    return pa ? pa->pages_live : 0;
+}
+
+// Slots per page
+static usize paged_per_page(paged_indexarray pa) {
+    return pa ? pa->per_page : 0;
+}
+
+// Get stride
+static usize paged_stride(paged_indexarray pa) {
+    return pa ? pa->stride : 0;
+}
+
+// Empty every slot; pages are kept for reuse (trim releases them)
+static void paged_clear(paged_indexarray pa) {
+    if (!pa) {
+        return;
+    }
+    for (usize p = 0; p < pa->directory_size; p++) {
+        if (pa->pages[p]) {
+            array_bitmap_reset(pa->pages[p]->occupancy, pa->per_page);
+            pa->pages[p]->live = 0;
+        }
+    }
+    pa->live = 0;
+    pa->first_open = 0;
+}
+
+// Internal ops table for sparse iterator interface
+static const sc_sparse_i paged_sparse_ops = {
+    .is_empty_slot = (bool (*)(object, usize))paged_is_empty_slot,
+    .capacity = (usize (*)(object))paged_capacity,
+    .get_at = (int (*)(object, usize, object *))paged_get_at};
+
+// Create sparse iterator over occupied slots
+static sparse_iterator paged_create_iterator(paged_indexarray pa) {
+    if (!pa) {
+        return NULL;
+    }
+    return sparse_iterator_new(pa->use, pa, &paged_sparse_ops);
+}
+
+// Allocate a page with cleared occupancy; value bytes are written by add before any read
+static paged_page *paged_page_new(paged_indexarray pa) {
+    usize header = sizeof(paged_page) + sizeof(uint64_t) * BITMAP_WORDS(pa->per_page);
+    if (pa->per_page > (SIZE_MAX - header - PAGED_DATA_ALIGN) / pa->stride) {
+        return NULL;
+    }
+    paged_page *page =
+        coll_alloc(pa->use, header + PAGED_DATA_ALIGN - 1 + pa->per_page * pa->stride);
+    if (!page) {
+        return NULL;
+    }
+    page->live = 0;
+    page->data = (char *)(((uintptr_t)page + header + PAGED_DATA_ALIGN - 1) &
+                          ~(uintptr_t)(PAGED_DATA_ALIGN - 1));
+    array_bitmap_reset(page->occupancy, pa->per_page);
+    return page;
+}
+
+// Return a page to the allocator; its index range stays reserved in the directory
+static void paged_page_free(paged_indexarray pa, usize page) {
+    coll_free(pa->use, pa->pages[page]);
+    pa->pages[page] = NULL;
+    pa->pages_live--;
+    if (page < pa->first_open) {
+        pa->first_open = page;
+    }
+}
+
+// Double the directory; only the pointer table moves, never a page
+static int paged_directory_grow(paged_indexarray pa) {
+    usize size = pa->directory_size;
+    usize new_size = size ? size * 2 : PAGED_MIN_DIRECTORY;
+    if (new_size > SIZE_MAX / sizeof(paged_page *)) {
+        return ERR;
+    }
+    paged_page **pages = coll_realloc(pa->use, pa->pages, sizeof(paged_page *) * size,
+                                      sizeof(paged_page *) * new_size);
+    if (!pages) {
+        return ERR;
+    }
+    memset(pages + size, 0, sizeof(paged_page *) * (new_size - size));
+    pa->pages = pages;
+    pa->directory_size = new_size;
+    return OK;
+}
+
+// Address of a live slot, or NULL if empty, released or out of range
+static object paged_slot(paged_indexarray pa, usize index) {
+    if (!pa || index >= paged_capacity(pa)) {
+        return NULL;
+    }
+    paged_page *page = pa->pages[index >> pa->page_shift];
+    usize slot = index & (pa->per_page - 1);
+    if (!page || !BITMAP_TEST(page->occupancy, slot)) {
+        return NULL;
+    }
+    return page->data + slot * pa->stride;
+}
+
+// Public interface implementation
+const sc_paged_indexarray_i PagedIndexArray = {
+    .new = paged_new,
+    .new_with = paged_new_with,
+    .dispose = paged_dispose,
+    .add = paged_add,
+    .get_at = paged_get_at,
+    .get_ptr = paged_get_ptr,
+    .remove_at = paged_remove_at,
+    .set_release_empty = paged_set_release_empty,
+    .trim = paged_trim,
+    .is_empty_slot = paged_is_empty_slot,
+    .capacity = paged_capacity,
+    .count = paged_count,
+    .page_count = paged_page_count,
+    .per_page = paged_per_page,
+    .stride = paged_stride,
+    .clear = paged_clear,
+    .create_iterator = paged_create_iterator,
+};
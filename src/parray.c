@@ -35,8 +35,11 @@
 #include "internal/array_base.h"
 #include "internal/arrays.h"
 #include "internal/collections.h"
+#include "sc_fast.h"
 // ------------------------------
 #include <sigma.core/allocator.h>
+#include <limits.h>
+#include <stddef.h>
 #include <string.h>
 
 //  declare the PointerArray struct: the collection with attitude
@@ -44,18 +47,32 @@ struct sc_pointer_array {
     char handle[2];  // {'P', '\0'} - type identifier
     addr *bucket;    // pointer to first element (array of addr)
     addr end;        // one past allocated memory (as raw addr)
+    sc_alloc_use_t *use;  // instance allocator (NULL = Allocator facade)
+    uint32_t version;     // bumped whenever a slot may have been emptied; slotarray views rescan
 };
 
+// sc_fast.h and array_base read the leading fields directly
+_Static_assert(offsetof(struct sc_pointer_array, bucket) == offsetof(sc_fast_head, bucket) &&
+                   offsetof(struct sc_pointer_array, end) == offsetof(sc_fast_head, end),
+               "sc_pointer_array layout must start with sc_fast_head");
+
 #if 1  // Region: Forward declarations
 // API functions
 static parray parray_new(usize);
+static parray parray_new_with(sc_alloc_use_t *, usize);
+static parray parray_new_aligned(usize, usize);
+static parray parray_new_aligned_with(sc_alloc_use_t *, usize, usize);
 static void parray_init(parray *, usize);
+static int parray_resize(parray, usize);
+static int parray_reserve(parray, usize);
 static void parray_dispose(parray);
 static int parray_capacity(parray);
 static void parray_clear(parray);
 static int parray_set_at(parray, usize, addr);
 static int parray_get_at(parray, usize, addr *);
 static int parray_remove_at(parray, usize);
+static int parray_index_of(parray, addr);
+static int parray_find_any(parray, const addr *, usize, usize);
 
 // Collection interface functions
 static collection parray_as_collection(parray arr);
@@ -63,12 +80,23 @@ static collection parray_to_collection(parray arr);
 #endif
 
 // API function implementations
-static parray parray_new(usize capacity) {
+static parray parray_new(usize capacity) { return parray_new_with(NULL, capacity); }
+
+static parray parray_new_with(sc_alloc_use_t *use, usize capacity) {
+    return parray_new_aligned_with(use, capacity, SC_ALIGN_AUTO);
+}
+
+static parray parray_new_aligned(usize capacity, usize alignment) {
+    return parray_new_aligned_with(NULL, capacity, alignment);
+}
+
+static parray parray_new_aligned_with(sc_alloc_use_t *use, usize capacity, usize alignment) {
     void *bucket;
     char *end;
 
     struct sc_pointer_array *arr = array_alloc_struct_with_bucket(
-        sizeof(struct sc_pointer_array), 'P', sizeof(addr), capacity, &bucket, &end);
+        use, sizeof(struct sc_pointer_array), 'P', sizeof(addr), capacity, alignment, &bucket,
+        &end);
 
     if (!arr) {
         return NULL;
@@ -76,6 +104,8 @@ static parray parray_new(usize capacity) {
 
     arr->bucket = (addr *)bucket;
     arr->end = (addr)end;
+    arr->use = use;
+    arr->version = 0;
 
     PArray.clear((parray)arr);
     return (parray)arr;
@@ -88,56 +118,96 @@ static void parray_init(parray *arr, usize capacity) {
         *arr = parray_new(capacity);
     } else {
         // what to do about an array that's already initialized?
-        // for now, we just reallocate the bucket
-        if ((*arr)->bucket) {
-            Allocator.dispose((*arr)->bucket);
-        }
-        (*arr)->bucket = Allocator.alloc(sizeof(addr) * capacity);
+        // for now, we just reallocate the bucket, keeping its alignment request
+        usize alignment = array_bucket_alignment((*arr)->bucket);
+        array_free_bucket((*arr)->use, (*arr)->bucket);
+        (*arr)->bucket = array_alloc_bucket_aligned((*arr)->use, sizeof(addr), capacity, alignment);
         if (!(*arr)->bucket) {
             // allocation ERRed, handle error as needed
             return;
         }
         (*arr)->end = (addr)((*arr)->bucket + capacity);
+        (*arr)->version++;
     }
 }
 
+// change capacity in place; contents are preserved and only a new tail is cleared
+static int parray_resize(parray arr, usize new_capacity) {
+    return parray_resize_bucket(arr, new_capacity);
+}
+
+// grow to at least min_capacity; never shrinks
+static int parray_reserve(parray arr, usize min_capacity) {
+    if (!arr) {
+        return ERR;
+    }
+    if ((usize)parray_capacity(arr) >= min_capacity) {
+        return OK;
+    }
+    return parray_resize_bucket(arr, min_capacity);
+}
+
 static void parray_dispose(parray arr) {
     if (!arr) {
         return;  // nothing to dispose
     }
 
     //  free the bucket and the array structure itself
-    array_free_resources(arr->bucket, arr);
+    array_free_resources(arr->use, arr->bucket, arr);
 }
 
 static int parray_capacity(parray arr) {
     return array_base_capacity((sc_array_base *)arr, sizeof(addr));
 }
 
+static int parray_index_of(parray arr, addr value) {
+    return parray_find_any(arr, &value, 1, 0);
+}
+
+static int parray_find_any(parray arr, const addr *values, usize count, usize from) {
+    if (!values || count == 0) {
+        return ERR;
+    }
+    usize capacity = (usize)parray_capacity(arr);
+    if (from >= capacity) {
+        return ERR;
+    }
+    usize hit = array_simd_find(arr->bucket + from, capacity - from, sizeof(addr), values, count);
+    return hit < capacity - from ? (int)(from + hit) : ERR;
+}
+
 static void parray_clear(parray arr) {
-    array_base_clear((sc_array_base *)arr, sizeof(addr), parray_element_clear);
+    if (arr) {
+        arr->version++;
+    }
+    array_base_zero((sc_array_base *)arr);  // ADDR_EMPTY is all-zero
 }
 
 static int parray_set_at(parray arr, usize index, addr value) {
-    return array_base_set_element((sc_array_base *)arr, sizeof(addr), index, &value,
-                                  parray_element_copy);
+    if (arr && value == ADDR_EMPTY) {
+        arr->version++;
+    }
+    return array_base_store((sc_array_base *)arr, sizeof(addr), index, &value);
 }
 
 static int parray_get_at(parray arr, usize index, addr *out_value) {
-    return array_base_get_element((sc_array_base *)arr, sizeof(addr), index, out_value,
-                                  parray_element_copy);
+    return array_base_load((sc_array_base *)arr, sizeof(addr), index, out_value);
 }
 
 static int parray_remove_at(parray arr, usize index) {
-    return array_base_remove_element((sc_array_base *)arr, sizeof(addr), index,
-                                     parray_element_clear);
+    if (arr) {
+        arr->version++;
+    }
+    return array_base_zero_element((sc_array_base *)arr, sizeof(addr), index);
 }
 
 #if 1  // Region: Internal utility functions
 // compact the array by shifting non-empty elements to the front
 usize parray_compact(parray arr) {
-    return array_base_compact((sc_array_base *)arr, sizeof(addr), parray_element_is_empty,
-                              parray_element_copy, parray_element_clear);
+    if (arr) {
+        arr->version++;
+    }
+    return array_base_compact_zero((sc_array_base *)arr, sizeof(addr));
 }
 
 // Internal functions for bucket access
@@ -155,6 +225,37 @@ addr *parray_get_bucket(parray arr) {
     if (!arr) return NULL;
     return arr->bucket;
 }
+
+// change counter for slot emptying; equal values mean no slot was emptied in between
+uint32_t parray_get_version(parray arr) {
+    if (!arr) return 0;
+    return arr->version;
+}
+
+// reallocate the bucket to new_capacity slots, preserving contents and emptying any new tail
+int parray_resize_bucket(parray arr, usize new_capacity) {
+    if (!arr || new_capacity == 0 || new_capacity > INT_MAX ||
+        new_capacity > SIZE_MAX / sizeof(addr)) {
+        return ERR;  // capacity is reported as int
+    }
+    usize old_capacity = PArray.capacity(arr);
+    if (new_capacity == old_capacity) {
+        return OK;
+    }
+
+    addr *bucket = array_realloc_bucket(arr->use, arr->bucket, sizeof(addr) * old_capacity,
+                                        sizeof(addr) * new_capacity);
+    if (!bucket) {
+        return ERR;  // original bucket is left intact
+    }
+    if (new_capacity > old_capacity) {
+        memset(bucket + old_capacity, 0, sizeof(addr) * (new_capacity - old_capacity));
+    }
+    arr->bucket = bucket;
+    arr->end = (addr)(bucket + new_capacity);
+    arr->version++;
+    return OK;
+}
 #endif
 
 #if 1  // Region: Array transformation functions
@@ -165,7 +266,7 @@ static collection parray_as_collection(parray arr) {
     }
 
     usize length = PArray.capacity(arr);
-    return Collections.create_view(arr, sizeof(addr), length, false);
+    return collection_create_view_with(arr->use, arr, sizeof(addr), length, false);
 }
 // create an owning collection copy of the parray
 static collection parray_to_collection(parray arr) {
@@ -174,7 +275,7 @@ static collection parray_to_collection(parray arr) {
     }
 
     usize capacity = PArray.capacity(arr);
-    collection coll = collection_new(capacity, sizeof(addr));
+    collection coll = collection_new(arr->use, capacity, sizeof(addr));
     if (!coll) {
         return NULL;
     }
@@ -191,7 +292,7 @@ static slotarray parray_as_slotarray(parray arr) {
         goto exit;
     }
 
-    sa = slotarray_create_view(arr);
+    sa = slotarray_create_view(arr->use, arr);
 
 exit:
     return sa;
@@ -201,13 +302,19 @@ exit:
 //  public interface implementation
 const sc_parray_i PArray = {
     .new = parray_new,
+    .new_with = parray_new_with,
+    .new_aligned = parray_new_aligned,
     .init = parray_init,
+    .resize = parray_resize,
+    .reserve = parray_reserve,
     .dispose = parray_dispose,
     .capacity = parray_capacity,
     .clear = parray_clear,
     .set = parray_set_at,
     .get = parray_get_at,
     .remove = parray_remove_at,
+    .index_of = parray_index_of,
+    .find_any = parray_find_any,
     .as_collection = parray_as_collection,
     .to_collection = parray_to_collection,
     .as_slotarray = parray_as_slotarray,
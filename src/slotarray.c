@@ -29,7 +29,7 @@
  *             with support for "slots" that can be reused after removal. SlotArray
  *             does not compact the underlying array on removal, preserving indices
  *             for existing elements, reusing freed slots for new elements. Compaction
- *             can be performed via a dedicated function if desired.
+ *             is explicit via SlotArray.compact, which returns an old->new index map.
  */
 
 #include "slotarray.h"
@@ -38,54 +38,93 @@
 #include "parray.h"
 // ------------------------------
 #include <sigma.core/allocator.h>
+#include <limits.h>
 #include <string.h>
 
 //  declare the SlotArray struct: uses parray internally
 struct sc_slotarray {
-    parray array;     // underlying parray for storage
-    usize next_slot;  // next slot to check for reuse
-    bool owns_array;  // whether the slotarray owns the parray
+    parray array;            // underlying parray for storage
+    uint32_t *free_slots;    // side stack of free slot indices (top = next slot handed out)
+    usize free_count;        // number of entries on the free stack
+    uint64_t *occupancy;     // occupancy bitmap, one bit per slot (set = live)
+    usize live;              // number of occupied slots
+    usize max_capacity;      // growth ceiling in slots (0 = unbounded)
+    uint32_t *generations;   // per-slot generation counters (NULL until a handle is issued)
+    uint32_t clear_generation;  // added to every slot generation in handles; bumped by clear
+    bool owns_array;         // whether the slotarray owns the parray
+    uint32_t array_version;  // parray version at the last rescan (views rescan only on change)
+    void *values;            // backing block for from_value_array copies (NULL otherwise)
+    sc_alloc_use_t *use;     // instance allocator (NULL = Allocator facade)
 };
 
+static slotarray slotarray_new_with(sc_alloc_use_t *use, usize capacity);
+static usize slotarray_capacity(slotarray sa);
+
+// Helper functions
+static int slotarray_free_list_init(slotarray sa);
+static void slotarray_free_list_rebuild(slotarray sa);
+static int slotarray_free_list_pop(slotarray sa);
+static void slotarray_free_list_push(slotarray sa, usize index);
+static int slotarray_grow(slotarray sa);
+static int slotarray_generations_ensure(slotarray sa);
+
 // forward declaration of internal functions
-slotarray slotarray_create_view(parray arr) {
+slotarray slotarray_create_view(sc_alloc_use_t *use, parray arr) {
     slotarray sa = NULL;
     if (!arr) {
         goto exit;
     }
-    sa = Allocator.alloc(sizeof(struct sc_slotarray));
+    sa = coll_alloc(use, sizeof(struct sc_slotarray));
     if (!sa) {
         goto exit;
     }
 
     sa->array = arr;
-    sa->next_slot = 0;
+    sa->max_capacity = PArray.capacity(arr);  // views never grow the caller's parray
+    sa->generations = NULL;
+    sa->clear_generation = 0;
     sa->owns_array = false;  // view does not own the parray
+    sa->values = NULL;
+    sa->use = use;
+    if (slotarray_free_list_init(sa) != OK) {
+        coll_free(use, sa);
+        sa = NULL;
+    }
 
 exit:
     return sa;
 }
 
 // create new slotarray with specified initial capacity
-static slotarray slotarray_new(usize capacity) {
+static slotarray slotarray_new(usize capacity) { return slotarray_new_with(NULL, capacity); }
+// create new slotarray whose allocations all go through the given allocator
+static slotarray slotarray_new_with(sc_alloc_use_t *use, usize capacity) {
     //  allocate memory for the slotarray structure
-    slotarray sa = Allocator.alloc(sizeof(struct sc_slotarray));
+    slotarray sa = coll_alloc(use, sizeof(struct sc_slotarray));
     if (!sa) {
         goto exit;
     }
 
     // create underlying parray
-    sa->array = PArray.new(capacity);
+    sa->array = PArray.new_with(use, capacity);
     if (!sa->array) {
         goto cleanup;
     }
 
-    sa->next_slot = 0;
+    sa->max_capacity = 0;   // grow on demand
+    sa->generations = NULL;
+    sa->clear_generation = 0;
     sa->owns_array = true;  // slotarray owns the parray
+    sa->values = NULL;
+    sa->use = use;
+    if (slotarray_free_list_init(sa) != OK) {
+        PArray.dispose(sa->array);
+        goto cleanup;
+    }
     return sa;
 
 cleanup:
-    Allocator.dispose(sa);
+    coll_free(use, sa);
     sa = NULL;
 
 exit:
@@ -99,30 +138,41 @@ static void slotarray_dispose(slotarray sa) {
     if (sa->owns_array) {
         PArray.dispose(sa->array);
     }
-    Allocator.dispose(sa);
+    coll_free(sa->use, sa->free_slots);
+    coll_free(sa->use, sa->occupancy);
+    if (sa->generations) {
+        coll_free(sa->use, sa->generations);
+    }
+    if (sa->values) {
+        coll_free(sa->use, sa->values);
+    }
+    coll_free(sa->use, sa);
 }
 // add a value to the slotarray, reusing empty slots if available
 static int slotarray_add(slotarray sa, object value) {
-    if (!sa) {
-        return ERR;  // invalid slotarray
+    if (!sa || !value) {
+        return ERR;  // invalid slotarray, or NULL (indistinguishable from an empty slot)
     }
 
-    // try to find an empty slot starting from next_slot
-    usize capacity = PArray.capacity(sa->array);
-    for (usize i = 0; i < capacity; ++i) {
-        usize slot_index = (sa->next_slot + i) % capacity;
-        addr current_value;
-        if (PArray.get(sa->array, slot_index, &current_value) == OK &&
-            current_value == ADDR_EMPTY) {
-            // found an empty slot, set the value there
-            PArray.set(sa->array, slot_index, (addr)value);
-            sa->next_slot = (slot_index + 1) % capacity;  // update next_slot for next search
-            return (int)slot_index;                       // return the index where value was added
-        }
+    // pop a free slot in O(1)
+    int slot_index = slotarray_free_list_pop(sa);
+    if (slot_index < 0 && !sa->owns_array &&
+        parray_get_version(sa->array) != sa->array_version) {
+        // the parray was emptied directly since the last rescan; rescan before reporting full
+        slotarray_free_list_rebuild(sa);
+        slot_index = slotarray_free_list_pop(sa);
+    }
+    if (slot_index < 0 && slotarray_grow(sa) == OK) {
+        slot_index = slotarray_free_list_pop(sa);
+    }
+    if (slot_index < 0) {
+        return ERR;  // no empty slot found, cannot add
     }
 
-    // no empty slot found, cannot add
-    return ERR;
+    parray_get_bucket(sa->array)[slot_index] = (addr)value;
+    BITMAP_SET(sa->occupancy, (usize)slot_index);
+    sa->live++;
+    return slot_index;
 }
 
 // get the value at the specified index in the slotarray
@@ -145,8 +195,21 @@ static int slotarray_remove_at(slotarray sa, usize index) {
     if (!sa) {
         return ERR;  // invalid slotarray
     }
-    // set the slot to ADDR_EMPTY to mark it as empty
-    PArray.set(sa->array, index, ADDR_EMPTY);
+    if (index >= slotarray_capacity(sa)) {
+        return ERR;  // index out of bounds
+    }
+
+    // set the slot to ADDR_EMPTY to mark it as empty; only occupied slots go back on the stack
+    addr *slots = parray_get_bucket(sa->array);
+    if (slots[index] != ADDR_EMPTY) {
+        slots[index] = ADDR_EMPTY;
+        BITMAP_CLEAR(sa->occupancy, index);
+        sa->live--;
+        if (sa->generations) {
+            sa->generations[index]++;  // retire outstanding handles to this slot
+        }
+        slotarray_free_list_push(sa, index);
+    }
     return OK;
 }
 // check if a slot is empty
@@ -169,15 +232,230 @@ static usize slotarray_capacity(slotarray sa) {
     return PArray.capacity(sa->array);
 }
 
+// add a value and return a generational handle to its slot
+static sc_handle slotarray_add_handle(slotarray sa, object value) {
+    if (!sa || slotarray_generations_ensure(sa) != OK) {
+        return SC_HANDLE_NULL;
+    }
+    int index = slotarray_add(sa, value);
+    if (index < 0) {
+        return SC_HANDLE_NULL;
+    }
+    return SC_HANDLE_MAKE(index, sa->generations[index] + sa->clear_generation);
+}
+// get the value behind a handle; stale handles fail on the generation compare
+static int slotarray_get_handle(slotarray sa, sc_handle handle, object *out_value) {
+    if (!sa || array_check_generation(sa->generations, sa->clear_generation, slotarray_capacity(sa),
+                                     handle) != OK) {
+        return ERR;
+    }
+    return slotarray_get_at(sa, SC_HANDLE_INDEX(handle), out_value);
+}
+// remove the value behind a handle, invalidating the handle
+static int slotarray_remove_handle(slotarray sa, sc_handle handle) {
+    if (!sa || array_check_generation(sa->generations, sa->clear_generation, slotarray_capacity(sa),
+                                     handle) != OK) {
+        return ERR;
+    }
+    usize index = SC_HANDLE_INDEX(handle);
+    if (parray_get_bucket(sa->array)[index] == ADDR_EMPTY) {
+        return ERR;  // already removed via remove_at
+    }
+    return slotarray_remove_at(sa, index);
+}
+
+// add n values in one pass; handles_out (optional) receives a handle per added value
+static int slotarray_add_many(slotarray sa, const object *values, usize n, sc_handle *handles_out) {
+    if (!sa || (n && !values) || n > (usize)INT_MAX) {
+        return ERR;
+    }
+    for (usize i = 0; i < n; i++) {
+        if (!values[i]) {
+            return ERR;  // reject the batch before claiming anything
+        }
+    }
+    if (handles_out && slotarray_generations_ensure(sa) != OK) {
+        return ERR;
+    }
+
+    // reserve every slot up front so the copy loop below never grows mid-batch
+    if (sa->free_count < n) {
+        while (sa->free_count < n && slotarray_grow(sa) == OK) {
+        }
+        // growth stacks new slots above older holes; reorder so slots are claimed in index order
+        slotarray_free_list_rebuild(sa);
+    }
+
+    addr *slots = parray_get_bucket(sa->array);
+    usize added = 0;
+    while (added < n) {
+        int slot_index = slotarray_free_list_pop(sa);
+        if (slot_index < 0) {
+            break;  // capped by max_capacity (or a view): report how many fit
+        }
+        slots[slot_index] = (addr)values[added];
+        BITMAP_SET(sa->occupancy, (usize)slot_index);
+        if (handles_out) {
+            handles_out[added] =
+                SC_HANDLE_MAKE(slot_index, sa->generations[slot_index] + sa->clear_generation);
+        }
+        added++;
+    }
+    sa->live += added;
+    return (int)added;
+}
+// remove the values behind n handles; stale handles are skipped
+static int slotarray_remove_many(slotarray sa, const sc_handle *handles, usize n) {
+    if (!sa || (n && !handles) || n > (usize)INT_MAX) {
+        return ERR;
+    }
+    usize capacity = slotarray_capacity(sa);
+    addr *slots = parray_get_bucket(sa->array);
+    usize removed = 0;
+    for (usize i = 0; i < n; i++) {
+        if (array_check_generation(sa->generations, sa->clear_generation, capacity, handles[i]) !=
+            OK) {
+            continue;
+        }
+        usize index = SC_HANDLE_INDEX(handles[i]);
+        if (slots[index] == ADDR_EMPTY) {
+            continue;  // already removed via remove_at
+        }
+        slots[index] = ADDR_EMPTY;
+        BITMAP_CLEAR(sa->occupancy, index);
+        sa->generations[index]++;
+        slotarray_free_list_push(sa, index);
+        removed++;
+    }
+    sa->live -= removed;
+    return (int)removed;
+}
+
+// limit how far an owning slotarray may grow (0 = unbounded)
+static int slotarray_set_max_capacity(slotarray sa, usize max_capacity) {
+    if (!sa || !sa->owns_array) {
+        return ERR;  // views are fixed to the caller's parray
+    }
+    if (max_capacity != 0 && max_capacity < slotarray_capacity(sa)) {
+        return ERR;  // would orphan existing handles
+    }
+    sa->max_capacity = max_capacity;
+    return OK;
+}
+
+// pack live slots to the front; remap (optional) receives old index -> new index (-1 if empty)
+static int slotarray_compact(slotarray sa, farray *remap) {
+    if (!sa) {
+        return ERR;
+    }
+    usize capacity = slotarray_capacity(sa);
+    int *table = NULL;
+    if (remap) {
+        *remap = FArray.new_with(sa->use, capacity ? capacity : 1, sizeof(int));
+        if (!*remap) {
+            return ERR;
+        }
+        table = farray_get_bucket(*remap);
+    }
+
+    addr *slots = parray_get_bucket(sa->array);
+    usize live = 0;
+    for (usize i = 0; i < capacity; i++) {
+        if (slots[i] == ADDR_EMPTY) {
+            if (table) table[i] = ERR;
+            continue;
+        }
+        if (i != live) {
+            slots[live] = slots[i];
+            slots[i] = ADDR_EMPTY;
+            if (sa->generations) {
+                // both slots changed contents: retire handles to either index
+                sa->generations[live]++;
+                sa->generations[i]++;
+            }
+        }
+        if (table) table[i] = (int)live;
+        live++;
+    }
+
+    slotarray_free_list_rebuild(sa);
+    return (int)live;
+}
+
+// release trailing empty slots of an owning slotarray (capacity never drops below 1)
+static int slotarray_shrink_to_fit(slotarray sa) {
+    if (!sa || !sa->owns_array) {
+        return ERR;  // views are fixed to the caller's parray
+    }
+    addr *slots = parray_get_bucket(sa->array);
+    usize capacity = slotarray_capacity(sa);
+    usize new_capacity = capacity;
+    while (new_capacity > 1 && slots[new_capacity - 1] == ADDR_EMPTY) {
+        new_capacity--;
+    }
+    if (new_capacity == capacity) {
+        return OK;
+    }
+
+    if (parray_resize_bucket(sa->array, new_capacity) != OK) {
+        return ERR;
+    }
+    // side tables may stay oversized if shrinking them fails; they only need to cover capacity
+    if (sa->generations) {
+        array_resize_epochs(sa->use, &sa->generations, capacity, new_capacity);
+    }
+    array_resize_bitmap(sa->use, &sa->occupancy, capacity, new_capacity);
+    uint32_t *free_slots =
+        coll_realloc(sa->use, sa->free_slots, sizeof(uint32_t) * capacity,
+                     sizeof(uint32_t) * new_capacity);
+    if (free_slots) {
+        sa->free_slots = free_slots;
+    }
+    if (sa->max_capacity && sa->max_capacity < new_capacity) {
+        sa->max_capacity = new_capacity;
+    }
+    slotarray_free_list_rebuild(sa);
+    return OK;
+}
+
+// number of occupied slots, tracked incrementally
+static usize slotarray_count(slotarray sa) {
+    return sa ? sa->live : 0;
+}
+
+// occupied slots / capacity (0 for an empty-capacity slotarray)
+static double slotarray_fill_ratio(slotarray sa) {
+    usize capacity = slotarray_capacity(sa);
+    return capacity ? (double)sa->live / (double)capacity : 0.0;
+}
+
+// longest run of consecutive empty slots, O(capacity / 64)
+static usize slotarray_largest_free_run(slotarray sa) {
+    if (!sa) {
+        return 0;
+    }
+    return array_bitmap_largest_free_run(sa->occupancy, slotarray_capacity(sa));
+}
+
+// 1 - largest_free_run / free slots: 0 when free space is contiguous, near 1 when scattered
+static double slotarray_fragmentation(slotarray sa) {
+    if (!sa) {
+        return 0.0;
+    }
+    return array_bitmap_fragmentation(sa->occupancy, slotarray_capacity(sa), sa->live);
+}
+
 // clear all slots in the slotarray
 static void slotarray_clear(slotarray sa) {
     if (!sa) {
         return;  // invalid slotarray
     }
     PArray.clear(sa->array);
+    sa->clear_generation++;  // retires every outstanding handle in O(1)
+    slotarray_free_list_rebuild(sa);
 }
 
-// create a slotarray from a parray
+// create a slotarray from a parray: non-empty pointers are packed in one pass
 static slotarray slotarray_from_pointer_array(parray arr) {
     if (!arr) {
         return NULL;
@@ -187,37 +465,44 @@ static slotarray slotarray_from_pointer_array(parray arr) {
     if (!sa) {
         return NULL;
     }
+
+    const addr *src = parray_get_bucket(arr);
+    addr *slots = parray_get_bucket(sa->array);
+    usize live = 0;
     for (usize i = 0; i < cap; i++) {
-        addr value;
-        if (PArray.get(arr, i, &value) == OK && value != ADDR_EMPTY) {
-            SlotArray.add(sa, (object)value);
+        if (src[i] != ADDR_EMPTY) {
+            slots[live++] = src[i];
         }
     }
+    slotarray_free_list_rebuild(sa);  // occupancy and live count in the same scan
     return sa;
 }
 
-// create a slotarray from a farray
+// create a slotarray from a farray: every element is copied into one block owned by the
+// slotarray (released by dispose) with a single memcpy, and slot i points at copy i
 static slotarray slotarray_from_value_array(farray arr, usize stride) {
-    if (!arr) {
+    if (!arr || stride == 0) {
         return NULL;
     }
     usize cap = FArray.capacity(arr, stride);
     slotarray sa = SlotArray.new(cap);
-    if (!sa) {
+    if (!sa || cap == 0) {
+        return sa;
+    }
+
+    sa->values = coll_alloc(sa->use, cap * stride);
+    if (!sa->values) {
+        SlotArray.dispose(sa);
         return NULL;
     }
+    farray_epoch_sync(arr, stride);  // stale epoch slots must copy as zero
+    memcpy(sa->values, farray_get_bucket(arr), cap * stride);
+
+    addr *slots = parray_get_bucket(sa->array);
     for (usize i = 0; i < cap; i++) {
-        void *value = Allocator.alloc(stride);
-        if (!value) {
-            SlotArray.dispose(sa);
-            return NULL;
-        }
-        if (FArray.get(arr, i, stride, value) == OK) {
-            SlotArray.add(sa, value);
-        } else {
-            Allocator.dispose(value);
-        }
+        slots[i] = (addr)((char *)sa->values + i * stride);
     }
+    slotarray_free_list_rebuild(sa);
     return sa;
 }
 
@@ -232,20 +517,140 @@ static sparse_iterator slotarray_create_iterator(slotarray sa) {
     if (!sa) {
         return NULL;
     }
-    return sparse_iterator_new(sa, &slotarray_sparse_ops);
+    return sparse_iterator_new(sa->use, sa, &slotarray_sparse_ops);
+}
+
+// allocate the free stack and occupancy bitmap and seed them from the parray
+static int slotarray_free_list_init(slotarray sa) {
+    usize capacity = slotarray_capacity(sa);
+    sa->free_slots = coll_alloc(sa->use, sizeof(uint32_t) * (capacity ? capacity : 1));
+    sa->occupancy = array_alloc_bitmap(sa->use, capacity);
+    if (!sa->free_slots || !sa->occupancy) {
+        if (sa->free_slots) coll_free(sa->use, sa->free_slots);
+        if (sa->occupancy) coll_free(sa->use, sa->occupancy);
+        return ERR;
+    }
+    slotarray_free_list_rebuild(sa);
+    return OK;
+}
+
+// rescan the parray; pushed in reverse so the lowest free index is handed out first
+static void slotarray_free_list_rebuild(slotarray sa) {
+    addr *slots = parray_get_bucket(sa->array);
+    usize capacity = slotarray_capacity(sa);
+    usize i = capacity;
+
+    sa->free_count = 0;
+    array_bitmap_reset(sa->occupancy, capacity);
+    while (i-- > 0) {
+        if (slots[i] == ADDR_EMPTY) {
+            sa->free_slots[sa->free_count++] = (uint32_t)i;
+        } else {
+            BITMAP_SET(sa->occupancy, i);
+        }
+    }
+    sa->live = capacity - sa->free_count;
+    sa->array_version = parray_get_version(sa->array);
+}
+
+// pop the next free slot index, or -1 when none remain
+static int slotarray_free_list_pop(slotarray sa) {
+    addr *slots = parray_get_bucket(sa->array);
+    while (sa->free_count > 0) {
+        uint32_t slot_index = sa->free_slots[--sa->free_count];
+        // entries can only go stale on views whose parray was written directly
+        if (slots[slot_index] == ADDR_EMPTY) {
+            return (int)slot_index;
+        }
+    }
+    return ERR;
+}
+
+// push a newly emptied slot index
+static void slotarray_free_list_push(slotarray sa, usize index) {
+    if (sa->free_count >= slotarray_capacity(sa)) {
+        // only reachable on views with stale duplicates on the stack
+        slotarray_free_list_rebuild(sa);
+        return;
+    }
+    sa->free_slots[sa->free_count++] = (uint32_t)index;
+}
+
+// double the parray (clamped to max_capacity) and push the new slots on the free stack
+static int slotarray_grow(slotarray sa) {
+    if (!sa->owns_array) {
+        return ERR;
+    }
+    usize capacity = slotarray_capacity(sa);
+    usize limit = sa->max_capacity ? sa->max_capacity : (usize)INT_MAX;  // handles are int
+    if (limit > (usize)INT_MAX) {
+        limit = (usize)INT_MAX;
+    }
+    if (capacity >= limit) {
+        return ERR;
+    }
+    usize new_capacity = capacity ? capacity * 2 : 8;
+    if (new_capacity > limit || new_capacity < capacity) {
+        new_capacity = limit;
+    }
+
+    if (sa->generations &&
+        array_resize_epochs(sa->use, &sa->generations, capacity, new_capacity) != OK) {
+        return ERR;
+    }
+    if (array_resize_bitmap(sa->use, &sa->occupancy, capacity, new_capacity) != OK) {
+        return ERR;
+    }
+    uint32_t *free_slots = coll_realloc(sa->use, sa->free_slots,
+                                        sizeof(uint32_t) * (capacity ? capacity : 1),
+                                        sizeof(uint32_t) * new_capacity);
+    if (!free_slots) {
+        return ERR;
+    }
+    sa->free_slots = free_slots;
+    if (parray_resize_bucket(sa->array, new_capacity) != OK) {
+        return ERR;  // stack is merely oversized; existing slots are untouched
+    }
+
+    // new slots are pushed in reverse so the lowest new index is handed out first
+    for (usize i = new_capacity; i-- > capacity;) {
+        sa->free_slots[sa->free_count++] = (uint32_t)i;
+    }
+    return OK;
+}
+
+// allocate the generation shadow on first use; slots start at generation 0
+static int slotarray_generations_ensure(slotarray sa) {
+    if (!sa->generations) {
+        sa->generations = array_alloc_epochs(sa->use, slotarray_capacity(sa));
+    }
+    return sa->generations ? OK : ERR;
 }
 
 // public interface implementation
 const sc_slotarray_i SlotArray = {
     .new = slotarray_new,
+    .new_with = slotarray_new_with,
     .dispose = slotarray_dispose,
     .add = slotarray_add,
     .get_at = slotarray_get_at,
     .remove_at = slotarray_remove_at,
+    .add_handle = slotarray_add_handle,
+    .get_handle = slotarray_get_handle,
+    .remove_handle = slotarray_remove_handle,
+    .add_many = slotarray_add_many,
+    .remove_many = slotarray_remove_many,
     .from_pointer_array = slotarray_from_pointer_array,
     .from_value_array = slotarray_from_value_array,
     .is_empty_slot = slotarray_is_empty_slot,
     .capacity = slotarray_capacity,
+    .set_max_capacity = slotarray_set_max_capacity,
     .clear = slotarray_clear,
+    .count = slotarray_count,
+    .fill_ratio = slotarray_fill_ratio,
+    .largest_free_run = slotarray_largest_free_run,
+    .fragmentation = slotarray_fragmentation,
+    .compact = slotarray_compact,
+    .shrink_to_fit = slotarray_shrink_to_fit,
     .create_iterator = slotarray_create_iterator,
 };
\ No newline at end of file
@@ -0,0 +1,336 @@
+/*
+ * Sigma Collections
+ * Copyright (c) 2026 David Boarman (BadKraft) and contributors
+ * QuantumOverride [Q|]
+ * ----------------------------------------------
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * ----------------------------------------------
+ * File: slotmap.c
+ * Description: Implementation of SlotMap - handles over densely packed values
+ */
+
+#include "slotmap.h"
+#include <sigma.core/allocator.h>
+#include <string.h>
+#include "internal/arrays.h"
+#include "internal/collections.h"
+
+#define SLOTMAP_NONE UINT32_MAX  // terminates the free index list
+#define SLOTMAP_MIN_GROWTH 8     // capacity used when growing from zero
+
+// SlotMap struct: dense FArray plus sparse/reverse index tables
+struct sc_slotmap {
+    farray values;              // densely packed values, positions [0, count) are live
+    uint32_t *sparse;           // index -> dense position (live) or next free index (vacant)
+    uint32_t *dense_to_index;   // dense position -> index
+    uint32_t *generations;      // per-index generation, bumped on remove
+    usize stride;               // element size in bytes
+    usize count;                // number of live values
+    usize capacity;             // slots in every table
+    uint32_t free_head;         // first vacant index (SLOTMAP_NONE when full)
+    sc_alloc_use_t *use;        // instance allocator (NULL = Allocator facade)
+};
+
+// Forward declarations
+static slotmap slotmap_new(usize capacity, usize stride);
+static slotmap slotmap_new_with(sc_alloc_use_t *use, usize capacity, usize stride);
+static void slotmap_dispose(slotmap sm);
+static int slotmap_get(slotmap sm, sc_handle handle, object out_value);
+static bool slotmap_is_past_end(slotmap sm, usize position);
+static usize slotmap_count(slotmap sm);
+
+// Helper functions
+static int slotmap_resolve(slotmap sm, sc_handle handle, usize *out_position);
+static void slotmap_link_free(slotmap sm, usize from, usize to);
+static int slotmap_grow(slotmap sm);
+
+// Create new slotmap
+static slotmap slotmap_new(usize capacity, usize stride) {
+    return slotmap_new_with(NULL, capacity, stride);
+}
+
+// Create new slotmap whose allocations, including growth, use the given allocator
+static slotmap slotmap_new_with(sc_alloc_use_t *use, usize capacity, usize stride) {
+    slotmap sm = NULL;
+
+    if (stride == 0 || capacity >= SLOTMAP_NONE) {
+        goto exit;
+    }
+
+    sm = coll_alloc(use, sizeof(struct sc_slotmap));
+    if (!sm) {
+        goto exit;
+    }
+    memset(sm, 0, sizeof(struct sc_slotmap));
+    sm->use = use;
+    sm->stride = stride;
+    sm->capacity = capacity;
+
+    sm->values = FArray.new_with(use, capacity, stride);
+    sm->sparse = coll_alloc(use, sizeof(uint32_t) * (capacity ? capacity : 1));
+    sm->dense_to_index = coll_alloc(use, sizeof(uint32_t) * (capacity ? capacity : 1));
+    sm->generations = array_alloc_epochs(use, capacity);
+    if (!sm->values || !sm->sparse || !sm->dense_to_index || !sm->generations) {
+        goto cleanup;
+    }
+
+    sm->free_head = SLOTMAP_NONE;
+    slotmap_link_free(sm, 0, capacity);
+    goto exit;
+
+cleanup:
+    slotmap_dispose(sm);
+    sm = NULL;
+
+exit:
+    return sm;
+}
+
+// Dispose of the slotmap
+static void slotmap_dispose(slotmap sm) {
+    if (!sm) {
+        return;
+    }
+    FArray.dispose(sm->values);
+    if (sm->sparse) {
+        coll_free(sm->use, sm->sparse);
+    }
+    if (sm->dense_to_index) {
+        coll_free(sm->use, sm->dense_to_index);
+    }
+    if (sm->generations) {
+        coll_free(sm->use, sm->generations);
+    }
+    coll_free(sm->use, sm);
+}
+
+// Append a value to dense storage and hand out a vacant index for it
+static sc_handle slotmap_add(slotmap sm, object value) {
+    if (!sm || !value) {
+        return SC_HANDLE_NULL;
+    }
+    if (sm->free_head == SLOTMAP_NONE && slotmap_grow(sm) != OK) {
+        return SC_HANDLE_NULL;
+    }
+
+    uint32_t index = sm->free_head;
+    usize position = sm->count++;
+    sm->free_head = sm->sparse[index];
+    sm->sparse[index] = (uint32_t)position;
+    sm->dense_to_index[position] = index;
+    memcpy((char *)farray_get_bucket(sm->values) + position * sm->stride, value, sm->stride);
+
+    return SC_HANDLE_MAKE(index, sm->generations[index]);
+}
+
+// Copy out the value behind a handle
+static int slotmap_get(slotmap sm, sc_handle handle, object out_value) {
+    usize position;
+    if (!out_value || slotmap_resolve(sm, handle, &position) != OK) {
+        return ERR;
+    }
+    memcpy(out_value, (char *)farray_get_bucket(sm->values) + position * sm->stride, sm->stride);
+    return OK;
+}
+
+// Pointer to the value behind a handle in dense storage
+static object slotmap_get_ptr(slotmap sm, sc_handle handle) {
+    usize position;
+    if (slotmap_resolve(sm, handle, &position) != OK) {
+        return NULL;
+    }
+    return (char *)farray_get_bucket(sm->values) + position * sm->stride;
+}
+
+// Remove the value behind a handle, swapping the last dense value into the hole
+static int slotmap_remove(slotmap sm, sc_handle handle) {
+    usize position;
+    if (slotmap_resolve(sm, handle, &position) != OK) {
+        return ERR;
+    }
+
+    char *bucket = farray_get_bucket(sm->values);
+    usize last = --sm->count;
+    if (position != last) {
+        memcpy(bucket + position * sm->stride, bucket + last * sm->stride, sm->stride);
+        uint32_t moved = sm->dense_to_index[last];
+        sm->dense_to_index[position] = moved;
+        sm->sparse[moved] = (uint32_t)position;
+    }
+    memset(bucket + last * sm->stride, 0, sm->stride);
+
+    // retire the handle and push its index on the free list
+    uint32_t index = (uint32_t)SC_HANDLE_INDEX(handle);
+    sm->generations[index]++;
+    sm->sparse[index] = sm->free_head;
+    sm->free_head = index;
+    return OK;
+}
+
+// Check whether a handle refers to a live value
+static bool slotmap_contains(slotmap sm, sc_handle handle) {
+    usize position;
+    return slotmap_resolve(sm, handle, &position) == OK;
+}
+
+// Number of live values
+static usize slotmap_count(slotmap sm) {
+    return sm ? sm->count : 0;
+}
+
+// Start of the dense value storage
+static object slotmap_values(slotmap sm) {
+    return sm ? farray_get_bucket(sm->values) : NULL;
+}
+
+// Handle of the value at a dense position
+static sc_handle slotmap_handle_at(slotmap sm, usize position) {
+    if (!sm || position >= sm->count) {
+        return SC_HANDLE_NULL;
+    }
+    uint32_t index = sm->dense_to_index[position];
+    return SC_HANDLE_MAKE(index, sm->generations[index]);
+}
+
+// Get capacity
+static usize slotmap_capacity(slotmap sm) {
+    return sm ? sm->capacity : 0;
+}
+
+// Get stride
+static usize slotmap_stride(slotmap sm) {
+    return sm ? sm->stride : 0;
+}
+
+// Remove every value in O(count); vacated indices return to the free list
+static void slotmap_clear(slotmap sm) {
+    if (!sm) {
+        return;
+    }
+    for (usize position = 0; position < sm->count; position++) {
+        uint32_t index = sm->dense_to_index[position];
+        sm->generations[index]++;
+        sm->sparse[index] = sm->free_head;
+        sm->free_head = index;
+    }
+    memset(farray_get_bucket(sm->values), 0, sm->count * sm->stride);
+    sm->count = 0;
+}
+
+// Dense positions past count read as empty to the sparse iterator
+static bool slotmap_is_past_end(slotmap sm, usize position) {
+    return position >= slotmap_count(sm);
+}
+
+// Copy out the value at a dense position
+static int slotmap_get_position(slotmap sm, usize position, object out_value) {
+    if (!out_value || slotmap_is_past_end(sm, position)) {
+        return ERR;
+    }
+    memcpy(out_value, (char *)farray_get_bucket(sm->values) + position * sm->stride, sm->stride);
+    return OK;
+}
+
+// Internal ops table for sparse iterator interface (dense: nothing to skip)
+static const sc_sparse_i slotmap_sparse_ops = {
+    .is_empty_slot = (bool (*)(object, usize))slotmap_is_past_end,
+    .capacity = (usize (*)(object))slotmap_count,
+    .get_at = (int (*)(object, usize, object *))slotmap_get_position};
+
+// Create iterator over the dense values
+static sparse_iterator slotmap_create_iterator(slotmap sm) {
+    if (!sm) {
+        return NULL;
+    }
+    return sparse_iterator_new(sm->use, sm, &slotmap_sparse_ops);
+}
+
+// Resolve a handle to its dense position: generation compare, then bounds/liveness
+static int slotmap_resolve(slotmap sm, sc_handle handle, usize *out_position) {
+    if (!sm || array_check_generation(sm->generations, 0, sm->capacity, handle) != OK) {
+        return ERR;
+    }
+    uint32_t index = (uint32_t)SC_HANDLE_INDEX(handle);
+    uint32_t position = sm->sparse[index];
+    if (position >= sm->count || sm->dense_to_index[position] != index) {
+        return ERR;  // vacant index (sparse holds a free-list link)
+    }
+    *out_position = position;
+    return OK;
+}
+
+// Thread indices [from, to) onto the front of the free list in ascending order
+static void slotmap_link_free(slotmap sm, usize from, usize to) {
+    for (usize i = to; i-- > from;) {
+        sm->sparse[i] = sm->free_head;
+        sm->free_head = (uint32_t)i;
+    }
+}
+
+// Double every table; only called when no index is vacant (count == capacity)
+static int slotmap_grow(slotmap sm) {
+    usize capacity = sm->capacity;
+    usize new_capacity = capacity ? capacity * 2 : SLOTMAP_MIN_GROWTH;
+    if (new_capacity >= SLOTMAP_NONE) {
+        new_capacity = SLOTMAP_NONE - 1;
+    }
+    if (new_capacity <= capacity) {
+        return ERR;
+    }
+
+    usize old_bytes = sizeof(uint32_t) * (capacity ? capacity : 1);
+    usize new_bytes = sizeof(uint32_t) * new_capacity;
+    uint32_t *sparse = coll_realloc(sm->use, sm->sparse, old_bytes, new_bytes);
+    if (!sparse) {
+        return ERR;
+    }
+    sm->sparse = sparse;
+    uint32_t *dense_to_index = coll_realloc(sm->use, sm->dense_to_index, old_bytes, new_bytes);
+    if (!dense_to_index) {
+        return ERR;
+    }
+    sm->dense_to_index = dense_to_index;
+    if (array_resize_epochs(sm->use, &sm->generations, capacity, new_capacity) != OK ||
+        farray_resize_bucket(sm->values, sm->stride, new_capacity) != OK) {
+        return ERR;  // tables are merely oversized; capacity is unchanged
+    }
+
+    sm->capacity = new_capacity;
+    slotmap_link_free(sm, capacity, new_capacity);
+    return OK;
+}
+
+// Public interface implementation
+const sc_slotmap_i SlotMap = {
+    .new = slotmap_new,
+    .new_with = slotmap_new_with,
+    .dispose = slotmap_dispose,
+    .add = slotmap_add,
+    .get = slotmap_get,
+    .get_ptr = slotmap_get_ptr,
+    .remove = slotmap_remove,
+    .contains = slotmap_contains,
+    .count = slotmap_count,
+    .values = slotmap_values,
+    .handle_at = slotmap_handle_at,
+    .capacity = slotmap_capacity,
+    .stride = slotmap_stride,
+    .clear = slotmap_clear,
+    .create_iterator = slotmap_create_iterator,
+};
@@ -0,0 +1,389 @@
+/*
+ * Sigma Collections
+ * Copyright (c) 2026 David Boarman (BadKraft) and contributors
+ * QuantumOverride [Q|]
+ * ----------------------------------------------
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * ----------------------------------------------
+ * File: soa_indexarray.c
+ * Description: Implementation of SoaIndexArray - structure-of-arrays indexarray
+ */
+
+#include "soa_indexarray.h"
+#include <sigma.core/allocator.h>
+#include <limits.h>
+#include <string.h>
+#include "internal/arrays.h"
+#include "internal/collections.h"
+
+#define SOA_MIN_GROWTH 8  // capacity used when growing from zero
+#define SOA_ALIGN_UP(n) (((n) + SOA_COLUMN_ALIGN - 1) & ~(usize)(SOA_COLUMN_ALIGN - 1))
+
+// SoaIndexArray struct: one block holds every column; the bitmap says which slots are live
+struct sc_soa_indexarray {
+    void *block;            // raw allocation holding every column
+    char **columns;         // per-field column start, SOA_COLUMN_ALIGN aligned inside block
+    sc_soa_field *fields;   // copied field descriptors
+    usize field_count;      // number of fields (columns)
+    usize record_size;      // size of a gathered record
+    usize capacity;         // slots in every column
+    usize next_slot;        // next slot to check for reuse
+    uint64_t *occupancy;    // occupancy bitmap, one bit per slot (set = live)
+    usize live;             // number of occupied slots
+    sc_alloc_use_t *use;    // instance allocator (NULL = Allocator facade)
+};
+
+// Forward declarations
+static soa_indexarray soa_new(usize capacity, const sc_soa_field *fields, usize field_count,
+                              usize record_size);
+static soa_indexarray soa_new_with(sc_alloc_use_t *use, usize capacity, const sc_soa_field *fields,
+                                   usize field_count, usize record_size);
+static soa_indexarray soa_new_split_with(sc_alloc_use_t *use, usize capacity, usize record_size,
+                                         usize hot_size);
+static void soa_dispose(soa_indexarray sa);
+static usize soa_capacity(soa_indexarray sa);
+
+// Helper functions
+static void *soa_alloc_columns(soa_indexarray sa, usize capacity, char **columns);
+static int soa_grow(soa_indexarray sa);
+static void soa_scatter(soa_indexarray sa, usize index, const void *record);
+static void soa_gather(soa_indexarray sa, usize index, void *out_record);
+
+// Create new soa_indexarray
+static soa_indexarray soa_new(usize capacity, const sc_soa_field *fields, usize field_count,
+                              usize record_size) {
+    return soa_new_with(NULL, capacity, fields, field_count, record_size);
+}
+
+// Create new soa_indexarray whose allocations, including growth, use the given allocator
+static soa_indexarray soa_new_with(sc_alloc_use_t *use, usize capacity, const sc_soa_field *fields,
+                                   usize field_count, usize record_size) {
+    soa_indexarray sa = NULL;
+
+    if (!fields || field_count == 0 || capacity > (usize)INT_MAX) {
+        goto exit;
+    }
+    for (usize k = 0; k < field_count; k++) {
+        if (fields[k].size == 0 || fields[k].offset > record_size ||
+            fields[k].size > record_size - fields[k].offset) {
+            goto exit;  // every field must lie inside the record
+        }
+    }
+
+    sa = coll_alloc(use, sizeof(struct sc_soa_indexarray));
+    if (!sa) {
+        goto exit;
+    }
+    memset(sa, 0, sizeof(struct sc_soa_indexarray));
+    sa->use = use;
+    sa->field_count = field_count;
+    sa->record_size = record_size;
+    sa->capacity = capacity;
+
+    sa->fields = coll_alloc(use, sizeof(sc_soa_field) * field_count);
+    sa->columns = coll_alloc(use, sizeof(char *) * field_count);
+    sa->occupancy = array_alloc_bitmap(use, capacity);
+    if (!sa->fields || !sa->columns || !sa->occupancy) {
+        goto cleanup;
+    }
+    memcpy(sa->fields, fields, sizeof(sc_soa_field) * field_count);
+    sa->block = soa_alloc_columns(sa, capacity, sa->columns);
+    if (!sa->block) {
+        goto cleanup;
+    }
+    goto exit;
+
+cleanup:
+    soa_dispose(sa);
+    sa = NULL;
+
+exit:
+    return sa;
+}
+
+// Create a two-column array: hot record prefix and cold remainder under the same index
+static soa_indexarray soa_new_split(usize capacity, usize record_size, usize hot_size) {
+    return soa_new_split_with(NULL, capacity, record_size, hot_size);
+}
+
+// Create a hot/cold split array whose allocations all go through the given allocator
+static soa_indexarray soa_new_split_with(sc_alloc_use_t *use, usize capacity, usize record_size,
+                                         usize hot_size) {
+    if (hot_size == 0 || hot_size >= record_size) {
+        return NULL;
+    }
+    const sc_soa_field parts[] = {
+        [SOA_HOT] = {0, hot_size},
+        [SOA_COLD] = {hot_size, record_size - hot_size},
+    };
+    return soa_new_with(use, capacity, parts, 2, record_size);
+}
+
+// Dispose of the soa_indexarray
+static void soa_dispose(soa_indexarray sa) {
+    if (!sa) {
+        return;
+    }
+    if (sa->block) {
+        coll_free(sa->use, sa->block);
+    }
+    if (sa->columns) {
+        coll_free(sa->use, sa->columns);
+    }
+    if (sa->fields) {
+        coll_free(sa->use, sa->fields);
+    }
+    if (sa->occupancy) {
+        coll_free(sa->use, sa->occupancy);
+    }
+    coll_free(sa->use, sa);
+}
+
+// Scatter a record into the first free slot at or after next_slot, growing if none is free
+static int soa_add(soa_indexarray sa, const void *record) {
+    if (!sa || !record) {
+        return ERR;
+    }
+
+    usize capacity = sa->capacity;
+    usize slot_index = capacity;
+    if (capacity) {
+        usize start = sa->next_slot % capacity;
+        slot_index = array_bitmap_next_clear(sa->occupancy, capacity, start);
+        if (slot_index == capacity) {
+            slot_index = array_bitmap_next_clear(sa->occupancy, start, 0);
+            if (slot_index == start) {
+                slot_index = capacity;
+            }
+        }
+    }
+    if (slot_index == capacity) {
+        if (soa_grow(sa) != OK) {
+            return ERR;
+        }
+        slot_index = capacity;  // first new slot
+    }
+
+    soa_scatter(sa, slot_index, record);
+    BITMAP_SET(sa->occupancy, slot_index);
+    sa->live++;
+    sa->next_slot = slot_index + 1;
+    return (int)slot_index;
+}
+
+// Gather the record at an occupied slot
+static int soa_get_at(soa_indexarray sa, usize index, void *out_record) {
+    if (!sa || !out_record || index >= sa->capacity || !BITMAP_TEST(sa->occupancy, index)) {
+        return ERR;
+    }
+    soa_gather(sa, index, out_record);
+    return OK;
+}
+
+// Scatter a record over an occupied slot
+static int soa_set_at(soa_indexarray sa, usize index, const void *record) {
+    if (!sa || !record || index >= sa->capacity || !BITMAP_TEST(sa->occupancy, index)) {
+        return ERR;
+    }
+    soa_scatter(sa, index, record);
+    return OK;
+}
+
+// Remove the record at a slot; column bytes are left for the next add to overwrite
+static int soa_remove_at(soa_indexarray sa, usize index) {
+    if (!sa || index >= sa->capacity) {
+        return ERR;
+    }
+    if (BITMAP_TEST(sa->occupancy, index)) {
+        BITMAP_CLEAR(sa->occupancy, index);
+        sa->live--;
+    }
+    return OK;
+}
+
+// Column start of one field
+static object soa_column(soa_indexarray sa, usize field) {
+    if (!sa || field >= sa->field_count) {
+        return NULL;
+    }
+    return sa->columns[field];
+}
+
+// Pointer to one field of an occupied slot
+static object soa_field_at(soa_indexarray sa, usize index, usize field) {
+    if (!sa || field >= sa->field_count || index >= sa->capacity ||
+        !BITMAP_TEST(sa->occupancy, index)) {
+        return NULL;
+    }
+    return sa->columns[field] + index * sa->fields[field].size;
+}
+
+// Occupancy bitmap for masking column loops
+static const uint64_t *soa_occupancy(soa_indexarray sa) {
+    return sa ? sa->occupancy : NULL;
+}
+
+// Check if slot is empty
+static bool soa_is_empty_slot(soa_indexarray sa, usize index) {
+    if (!sa || index >= sa->capacity) {
+        return true;
+    }
+    return !BITMAP_TEST(sa->occupancy, index);
+}
+
+// Get capacity
+static usize soa_capacity(soa_indexarray sa) {
+    return sa ? sa->capacity : 0;
+}
+
+// Occupied slots
+static usize soa_count(soa_indexarray sa) {
+    return sa ? sa->live : 0;
+}
+
+// Number of columns
+static usize soa_field_count(soa_indexarray sa) {
+    return sa ? sa->field_count : 0;
+}
+
+// Gathered record size
+static usize soa_record_size(soa_indexarray sa) {
+    return sa ? sa->record_size : 0;
+}
+
+// Empty every slot by resetting the bitmap; columns are not rewritten
+static void soa_clear(soa_indexarray sa) {
+    if (!sa) {
+        return;
+    }
+    array_bitmap_reset(sa->occupancy, sa->capacity);
+    sa->live = 0;
+    sa->next_slot = 0;
+}
+
+// Internal ops table for sparse iterator interface
+static const sc_sparse_i soa_sparse_ops = {
+    .is_empty_slot = (bool (*)(object, usize))soa_is_empty_slot,
+    .capacity = (usize (*)(object))soa_capacity,
+    .get_at = (int (*)(object, usize, object *))soa_get_at};
+
+// Create sparse iterator over occupied slots
+static sparse_iterator soa_create_iterator(soa_indexarray sa) {
+    if (!sa) {
+        return NULL;
+    }
+    return sparse_iterator_new(sa->use, sa, &soa_sparse_ops);
+}
+
+// Allocate one zeroed block for capacity slots of every column and point columns into it
+static void *soa_alloc_columns(soa_indexarray sa, usize capacity, char **columns) {
+    usize total = SOA_COLUMN_ALIGN - 1;  // slack to align the first column
+    for (usize k = 0; k < sa->field_count; k++) {
+        usize size = sa->fields[k].size;
+        if (capacity > (SIZE_MAX - total - SOA_COLUMN_ALIGN) / size) {
+            return NULL;
+        }
+        total += SOA_ALIGN_UP(size * capacity);
+    }
+
+    void *block = coll_alloc(sa->use, total);
+    if (!block) {
+        return NULL;
+    }
+    memset(block, 0, total);
+
+    char *base = (char *)SOA_ALIGN_UP((uintptr_t)block);
+    for (usize k = 0; k < sa->field_count; k++) {
+        columns[k] = base;
+        base += SOA_ALIGN_UP(sa->fields[k].size * capacity);
+    }
+    return block;
+}
+
+// Double every column into a fresh block; slot indices are unchanged
+static int soa_grow(soa_indexarray sa) {
+    usize capacity = sa->capacity;
+    usize new_capacity = capacity ? capacity * 2 : SOA_MIN_GROWTH;
+    if (new_capacity > (usize)INT_MAX) {
+        new_capacity = (usize)INT_MAX;
+    }
+    if (new_capacity <= capacity) {
+        return ERR;
+    }
+
+    char **columns = coll_alloc(sa->use, sizeof(char *) * sa->field_count);
+    if (!columns) {
+        return ERR;
+    }
+    void *block = soa_alloc_columns(sa, new_capacity, columns);
+    if (!block || array_resize_bitmap(sa->use, &sa->occupancy, capacity, new_capacity) != OK) {
+        if (block) coll_free(sa->use, block);
+        coll_free(sa->use, columns);
+        return ERR;
+    }
+
+    for (usize k = 0; k < sa->field_count; k++) {
+        memcpy(columns[k], sa->columns[k], sa->fields[k].size * capacity);
+    }
+    coll_free(sa->use, sa->block);
+    coll_free(sa->use, sa->columns);
+    sa->block = block;
+    sa->columns = columns;
+    sa->capacity = new_capacity;
+    return OK;
+}
+
+// Copy each described field of a record into its column
+static void soa_scatter(soa_indexarray sa, usize index, const void *record) {
+    for (usize k = 0; k < sa->field_count; k++) {
+        usize size = sa->fields[k].size;
+        memcpy(sa->columns[k] + index * size, (const char *)record + sa->fields[k].offset, size);
+    }
+}
+
+// Copy each column's element back into its place in a record
+static void soa_gather(soa_indexarray sa, usize index, void *out_record) {
+    for (usize k = 0; k < sa->field_count; k++) {
+        usize size = sa->fields[k].size;
+        memcpy((char *)out_record + sa->fields[k].offset, sa->columns[k] + index * size, size);
+    }
+}
+
+// Public interface implementation
+const sc_soa_indexarray_i SoaIndexArray = {
+    .new = soa_new,
+    .new_with = soa_new_with,
+    .new_split = soa_new_split,
+    .new_split_with = soa_new_split_with,
+    .dispose = soa_dispose,
+    .add = soa_add,
+    .get_at = soa_get_at,
+    .set_at = soa_set_at,
+    .remove_at = soa_remove_at,
+    .column = soa_column,
+    .field_at = soa_field_at,
+    .occupancy = soa_occupancy,
+    .is_empty_slot = soa_is_empty_slot,
+    .capacity = soa_capacity,
+    .count = soa_count,
+    .field_count = soa_field_count,
+    .record_size = soa_record_size,
+    .clear = soa_clear,
+    .create_iterator = soa_create_iterator,
+};
@@ -0,0 +1,442 @@
+/*
+ * Sigma Collections
+ * Copyright (c) 2026 David Boarman (BadKraft) and contributors
+ * QuantumOverride [Q|]
+ * ----------------------------------------------
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * ----------------------------------------------
+ * File: sparseset.c
+ * Description: Implementation of SparseSet - entity-keyed component storage
+ */
+
+#include "sparseset.h"
+#include <sigma.core/allocator.h>
+#include <string.h>
+#include "internal/arrays.h"
+#include "internal/collections.h"
+
+#define SPARSESET_NONE UINT32_MAX  // not an entity id; returned when a join is not positioned
+#define SPARSESET_MIN_GROWTH 8     // capacity used when growing from zero
+
+// SparseSet struct: sparse id table over dense ids and components
+struct sc_sparseset {
+    farray components;       // dense components, positions [0, count) are live (NULL if stride 0)
+    uint32_t *dense;         // dense position -> entity id
+    uint32_t *sparse;        // entity id -> dense position; trusted only if dense agrees
+    usize stride;            // component size in bytes
+    usize count;             // number of entities present
+    usize capacity;          // entries in dense and components
+    usize sparse_capacity;   // entity ids covered by sparse
+    sc_alloc_use_t *use;     // instance allocator (NULL = Allocator facade)
+};
+
+// SparseJoin struct: smallest set drives, the rest are probed
+struct sc_sparse_join {
+    usize driver;            // position of the driving set in sets[]
+    usize position;          // dense position in the driver; walks down towards 0
+    uint32_t current;        // current entity (SPARSESET_NONE if not positioned)
+    usize count;             // number of joined sets
+    sc_alloc_use_t *use;     // allocator of the first set
+    sparseset sets[];        // joined sets, in caller order
+};
+
+// Forward declarations
+static sparseset sparseset_new(usize capacity, usize stride);
+static sparseset sparseset_new_with(sc_alloc_use_t *use, usize capacity, usize stride);
+static void sparseset_dispose(sparseset ss);
+static usize sparseset_count(sparseset ss);
+
+// Helper functions
+static int sparseset_position(sparseset ss, uint32_t entity, usize *out_position);
+static object sparseset_component_at(sparseset ss, usize position);
+static int sparseset_grow_dense(sparseset ss);
+static int sparseset_grow_sparse(sparseset ss, uint32_t entity);
+static void sparse_join_reset(sparse_join join);
+
+// Create new sparseset
+static sparseset sparseset_new(usize capacity, usize stride) {
+    return sparseset_new_with(NULL, capacity, stride);
+}
+
+// Create new sparseset whose allocations, including growth, use the given allocator
+static sparseset sparseset_new_with(sc_alloc_use_t *use, usize capacity, usize stride) {
+    sparseset ss = NULL;
+
+    if (capacity >= SPARSESET_NONE) {
+        goto exit;
+    }
+
+    ss = coll_alloc(use, sizeof(struct sc_sparseset));
+    if (!ss) {
+        goto exit;
+    }
+    memset(ss, 0, sizeof(struct sc_sparseset));
+    ss->use = use;
+    ss->stride = stride;
+    ss->capacity = capacity;
+    ss->sparse_capacity = capacity;
+
+    if (stride) {
+        ss->components = FArray.new_with(use, capacity, stride);
+        if (!ss->components) {
+            goto cleanup;
+        }
+    }
+    ss->dense = coll_alloc(use, sizeof(uint32_t) * (capacity ? capacity : 1));
+    ss->sparse = array_alloc_epochs(use, capacity);  // zeroed; never trusted on its own
+    if (!ss->dense || !ss->sparse) {
+        goto cleanup;
+    }
+    goto exit;
+
+cleanup:
+    sparseset_dispose(ss);
+    ss = NULL;
+
+exit:
+    return ss;
+}
+
+// Dispose of the sparseset
+static void sparseset_dispose(sparseset ss) {
+    if (!ss) {
+        return;
+    }
+    if (ss->components) {
+        FArray.dispose(ss->components);
+    }
+    if (ss->dense) {
+        coll_free(ss->use, ss->dense);
+    }
+    if (ss->sparse) {
+        coll_free(ss->use, ss->sparse);
+    }
+    coll_free(ss->use, ss);
+}
+
+// Insert an entity at the end of dense storage, or overwrite its component in place
+static int sparseset_insert(sparseset ss, uint32_t entity, object component) {
+    if (!ss || entity == SPARSESET_NONE) {
+        return ERR;
+    }
+
+    usize position;
+    if (sparseset_position(ss, entity, &position) != OK) {
+        if (entity >= ss->sparse_capacity && sparseset_grow_sparse(ss, entity) != OK) {
+            return ERR;
+        }
+        if (ss->count == ss->capacity && sparseset_grow_dense(ss) != OK) {
+            return ERR;
+        }
+        position = ss->count++;
+        ss->dense[position] = entity;
+        ss->sparse[entity] = (uint32_t)position;
+    }
+
+    object slot = sparseset_component_at(ss, position);
+    if (slot) {
+        if (component) {
+            memcpy(slot, component, ss->stride);
+        } else {
+            memset(slot, 0, ss->stride);
+        }
+    }
+    return OK;
+}
+
+// Remove an entity, swapping the last dense entry into its position
+static int sparseset_remove(sparseset ss, uint32_t entity) {
+    usize position;
+    if (sparseset_position(ss, entity, &position) != OK) {
+        return ERR;
+    }
+
+    usize last = --ss->count;
+    if (position != last) {
+        uint32_t moved = ss->dense[last];
+        ss->dense[position] = moved;
+        ss->sparse[moved] = (uint32_t)position;
+        if (ss->components) {
+            memcpy(sparseset_component_at(ss, position), sparseset_component_at(ss, last),
+                   ss->stride);
+        }
+    }
+    if (ss->components) {
+        memset(sparseset_component_at(ss, last), 0, ss->stride);
+    }
+    return OK;
+}
+
+// Check whether an entity is present
+static bool sparseset_contains(sparseset ss, uint32_t entity) {
+    usize position;
+    return sparseset_position(ss, entity, &position) == OK;
+}
+
+// Copy out an entity's component
+static int sparseset_get(sparseset ss, uint32_t entity, object out_value) {
+    usize position;
+    if (!out_value || sparseset_position(ss, entity, &position) != OK) {
+        return ERR;
+    }
+    if (ss->components) {
+        memcpy(out_value, sparseset_component_at(ss, position), ss->stride);
+    }
+    return OK;
+}
+
+// Pointer to an entity's component in dense storage
+static object sparseset_get_ptr(sparseset ss, uint32_t entity) {
+    usize position;
+    if (sparseset_position(ss, entity, &position) != OK) {
+        return NULL;
+    }
+    return sparseset_component_at(ss, position);
+}
+
+// Number of entities present
+static usize sparseset_count(sparseset ss) {
+    return ss ? ss->count : 0;
+}
+
+// Dense entity ids
+static const uint32_t *sparseset_entities(sparseset ss) {
+    return ss ? ss->dense : NULL;
+}
+
+// Dense components
+static object sparseset_components(sparseset ss) {
+    return ss && ss->components ? farray_get_bucket(ss->components) : NULL;
+}
+
+// Get stride
+static usize sparseset_stride(sparseset ss) {
+    return ss ? ss->stride : 0;
+}
+
+// Remove every entity; sparse entries go stale and are rejected by the dense check
+static void sparseset_clear(sparseset ss) {
+    if (!ss) {
+        return;
+    }
+    if (ss->components) {
+        memset(farray_get_bucket(ss->components), 0, ss->count * ss->stride);
+    }
+    ss->count = 0;
+}
+
+// Dense positions past count read as empty to the sparse iterator
+static bool sparseset_is_past_end(sparseset ss, usize position) {
+    return position >= sparseset_count(ss);
+}
+
+// Copy out the component at a dense position
+static int sparseset_get_position(sparseset ss, usize position, object out_value) {
+    if (!out_value || sparseset_is_past_end(ss, position)) {
+        return ERR;
+    }
+    if (ss->components) {
+        memcpy(out_value, sparseset_component_at(ss, position), ss->stride);
+    }
+    return OK;
+}
+
+// Internal ops table for sparse iterator interface (dense: nothing to skip)
+static const sc_sparse_i sparseset_sparse_ops = {
+    .is_empty_slot = (bool (*)(object, usize))sparseset_is_past_end,
+    .capacity = (usize (*)(object))sparseset_count,
+    .get_at = (int (*)(object, usize, object *))sparseset_get_position};
+
+// Create iterator over the dense components
+static sparse_iterator sparseset_create_iterator(sparseset ss) {
+    if (!ss) {
+        return NULL;
+    }
+    return sparse_iterator_new(ss->use, ss, &sparseset_sparse_ops);
+}
+
+// Resolve an entity to its dense position; the dense table must point back at the entity
+static int sparseset_position(sparseset ss, uint32_t entity, usize *out_position) {
+    if (!ss || entity >= ss->sparse_capacity) {
+        return ERR;
+    }
+    uint32_t position = ss->sparse[entity];
+    if (position >= ss->count || ss->dense[position] != entity) {
+        return ERR;
+    }
+    *out_position = position;
+    return OK;
+}
+
+// Component at a dense position (NULL for a tag set)
+static object sparseset_component_at(sparseset ss, usize position) {
+    if (!ss->components) {
+        return NULL;
+    }
+    return (char *)farray_get_bucket(ss->components) + position * ss->stride;
+}
+
+// Double the dense tables; only called when count == capacity
+static int sparseset_grow_dense(sparseset ss) {
+    usize capacity = ss->capacity;
+    usize new_capacity = capacity ? capacity * 2 : SPARSESET_MIN_GROWTH;
+    if (new_capacity >= SPARSESET_NONE) {
+        new_capacity = SPARSESET_NONE - 1;
+    }
+    if (new_capacity <= capacity) {
+        return ERR;
+    }
+
+    uint32_t *dense = coll_realloc(ss->use, ss->dense, sizeof(uint32_t) * (capacity ? capacity : 1),
+                                   sizeof(uint32_t) * new_capacity);
+    if (!dense) {
+        return ERR;
+    }
+    ss->dense = dense;
+    if (ss->components && farray_resize_bucket(ss->components, ss->stride, new_capacity) != OK) {
+        return ERR;  // dense is merely oversized; capacity is unchanged
+    }
+    ss->capacity = new_capacity;
+    return OK;
+}
+
+// Grow the sparse table to cover entity, at least doubling it
+static int sparseset_grow_sparse(sparseset ss, uint32_t entity) {
+    usize capacity = ss->sparse_capacity;
+    usize new_capacity = capacity ? capacity * 2 : SPARSESET_MIN_GROWTH;
+    if (new_capacity <= entity) {
+        new_capacity = (usize)entity + 1;
+    }
+    if (array_resize_epochs(ss->use, &ss->sparse, capacity, new_capacity) != OK) {
+        return ERR;
+    }
+    ss->sparse_capacity = new_capacity;
+    return OK;
+}
+
+// Create a join over n sets
+static sparse_join sparse_join_new(sparseset *sets, usize n) {
+    if (!sets || n == 0 || n > (SIZE_MAX - sizeof(struct sc_sparse_join)) / sizeof(sparseset)) {
+        return NULL;
+    }
+    for (usize i = 0; i < n; i++) {
+        if (!sets[i]) {
+            return NULL;
+        }
+    }
+
+    sparse_join join =
+        coll_alloc(sets[0]->use, sizeof(struct sc_sparse_join) + n * sizeof(sparseset));
+    if (!join) {
+        return NULL;
+    }
+    join->count = n;
+    join->use = sets[0]->use;
+    memcpy(join->sets, sets, n * sizeof(sparseset));
+    sparse_join_reset(join);
+    return join;
+}
+
+// Advance to the next entity of the driving set that every other set also holds
+static bool sparse_join_next(sparse_join join) {
+    if (!join) {
+        return false;
+    }
+    sparseset driver = join->sets[join->driver];
+    if (join->position > driver->count) {
+        join->position = driver->count;  // entities behind the cursor were removed
+    }
+
+    // walking down keeps swap-removal of the current entity from skipping anything
+    while (join->position > 0) {
+        uint32_t entity = driver->dense[--join->position];
+        bool all = true;
+        for (usize i = 0; i < join->count && all; i++) {
+            all = i == join->driver || sparseset_contains(join->sets[i], entity);
+        }
+        if (all) {
+            join->current = entity;
+            return true;
+        }
+    }
+    join->current = SPARSESET_NONE;
+    return false;
+}
+
+// Entity at the current position
+static uint32_t sparse_join_entity(sparse_join join) {
+    return join ? join->current : SPARSESET_NONE;
+}
+
+// Component of the current entity in one joined set
+static object sparse_join_component(sparse_join join, usize set) {
+    if (!join || set >= join->count || join->current == SPARSESET_NONE) {
+        return NULL;
+    }
+    return sparseset_get_ptr(join->sets[set], join->current);
+}
+
+// Pick the smallest set as driver and rewind
+static void sparse_join_reset(sparse_join join) {
+    if (!join) {
+        return;
+    }
+    join->driver = 0;
+    for (usize i = 1; i < join->count; i++) {
+        if (join->sets[i]->count < join->sets[join->driver]->count) {
+            join->driver = i;
+        }
+    }
+    join->position = join->sets[join->driver]->count;
+    join->current = SPARSESET_NONE;
+}
+
+// Free the join
+static void sparse_join_dispose(sparse_join join) {
+    if (join) {
+        coll_free(join->use, join);
+    }
+}
+
+// Public interface implementation
+const sc_sparseset_i SparseSet = {
+    .new = sparseset_new,
+    .new_with = sparseset_new_with,
+    .dispose = sparseset_dispose,
+    .insert = sparseset_insert,
+    .remove = sparseset_remove,
+    .contains = sparseset_contains,
+    .get = sparseset_get,
+    .get_ptr = sparseset_get_ptr,
+    .count = sparseset_count,
+    .entities = sparseset_entities,
+    .components = sparseset_components,
+    .stride = sparseset_stride,
+    .clear = sparseset_clear,
+    .create_iterator = sparseset_create_iterator,
+};
+
+const sc_sparse_join_i SparseJoin = {
+    .new = sparse_join_new,
+    .next = sparse_join_next,
+    .entity = sparse_join_entity,
+    .component = sparse_join_component,
+    .reset = sparse_join_reset,
+    .dispose = sparse_join_dispose,
+};
@@ -0,0 +1,237 @@
+/*
+ *  Test File: test_array_kernels.c
+ *  Description: Per-element cost of stride-specialized array kernels vs per-element callbacks
+ */
+
+#define _POSIX_C_SOURCE 199309L  // clock_gettime
+
+#include <sigma.test/sigtest.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "farray.h"
+#include "internal/array_base.h"
+#include "sc_fast.h"
+
+#define KERNEL_ELEMENTS 65536
+#define KERNEL_ROUNDS 200
+
+//  configure test set
+static void set_config(FILE **log_stream) {
+    *log_stream = fopen("logs/test_array_kernels.log", "w");
+}
+static void set_teardown(void) {
+}
+
+static double elapsed_ns(struct timespec *start, struct timespec *end) {
+    return (double)(end->tv_sec - start->tv_sec) * 1e9 + (double)(end->tv_nsec - start->tv_nsec);
+}
+
+// the callbacks array_base used for every element before the kernels
+static bool callback_is_empty(const void *element, usize element_size) {
+    const char *bytes = element;
+    for (usize i = 0; i < element_size; ++i) {
+        if (bytes[i] != 0) {
+            return false;
+        }
+    }
+    return true;
+}
+static void callback_clear(void *element, usize element_size) {
+    memset(element, 0, element_size);
+}
+static void callback_copy(void *dest, const void *src, usize element_size) {
+    memcpy(dest, src, element_size);
+}
+
+// every other element live, so compact moves half of them
+static void fill_half(farray arr, usize stride, char *value) {
+    for (usize i = 0; i < KERNEL_ELEMENTS; i += 2) {
+        value[0] = (char)(i | 1);
+        FArray.set(arr, i, stride, value);
+    }
+}
+
+// time set+get and compact per element through callbacks and through the kernels
+static void kernels_at_stride(usize stride) {
+    farray arr = FArray.new(KERNEL_ELEMENTS, stride);
+    Assert.isNotNull(arr, "FArray creation failed");
+    sc_array_base *base = (sc_array_base *)arr;
+    char *value = calloc(1, stride);
+    char *out = calloc(1, stride);
+    struct timespec start, end;
+    usize moved = 0;
+    double ns[4];
+
+    // set + get: one callback call per element vs one switch per call
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (usize r = 0; r < KERNEL_ROUNDS; r++) {
+        for (usize i = 0; i < KERNEL_ELEMENTS; i++) {
+            value[0] = (char)i;
+            array_base_set_element(base, stride, i, value, callback_copy);
+            array_base_get_element(base, stride, i, out, callback_copy);
+        }
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    ns[0] = elapsed_ns(&start, &end);
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (usize r = 0; r < KERNEL_ROUNDS; r++) {
+        for (usize i = 0; i < KERNEL_ELEMENTS; i++) {
+            value[0] = (char)i;
+            array_base_store(base, stride, i, value);
+            array_base_load(base, stride, i, out);
+        }
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    ns[1] = elapsed_ns(&start, &end);
+
+    // compact: empty test, copy and clear through callbacks vs the specialized loop
+    ns[2] = ns[3] = 0;
+    for (usize r = 0; r < KERNEL_ROUNDS; r++) {
+        array_base_zero(base);
+        fill_half(arr, stride, value);
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        moved += array_base_compact(base, stride, callback_is_empty, callback_copy, callback_clear);
+        clock_gettime(CLOCK_MONOTONIC, &end);
+        ns[2] += elapsed_ns(&start, &end);
+
+        array_base_zero(base);
+        fill_half(arr, stride, value);
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        moved -= array_base_compact_zero(base, stride);
+        clock_gettime(CLOCK_MONOTONIC, &end);
+        ns[3] += elapsed_ns(&start, &end);
+    }
+
+    Assert.areEqual(&(usize){0}, &moved, LONG, "Kernel and callback compaction should agree");
+    double per = (double)KERNEL_ROUNDS * KERNEL_ELEMENTS;
+    DebugLogger.log("\tstride %2zu: set+get %.2f -> %.2f ns, compact %.2f -> %.2f ns per element",
+                    stride, ns[0] / per, ns[1] / per, ns[2] / per, ns[3] / per);
+
+    free(value);
+    free(out);
+    FArray.dispose(arr);
+}
+
+// sum every element through the interface table and through the unchecked accessor
+static void test_array_kernels_fast_access(void) {
+    farray arr = FArray.new(KERNEL_ELEMENTS, sizeof(int));
+    Assert.isNotNull(arr, "FArray creation failed");
+    for (usize i = 0; i < KERNEL_ELEMENTS; i++) {
+        FArray.set(arr, i, sizeof(int), &(int){(int)i});
+    }
+    struct timespec start, end;
+    long long sums[2] = {0, 0};
+    double ns[2];
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (usize r = 0; r < KERNEL_ROUNDS; r++) {
+        for (usize i = 0; i < KERNEL_ELEMENTS; i++) {
+            int out = 0;
+            FArray.get(arr, i, sizeof(int), &out);
+            sums[0] += out;
+        }
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    ns[0] = elapsed_ns(&start, &end);
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (usize r = 0; r < KERNEL_ROUNDS; r++) {
+        for (usize i = 0; i < KERNEL_ELEMENTS; i++) {
+            sums[1] += FARRAY_AT(arr, int, i);
+        }
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    ns[1] = elapsed_ns(&start, &end);
+
+    Assert.areEqual(&sums[0], &sums[1], LONG, "Checked and unchecked sums should agree");
+    double per = (double)KERNEL_ROUNDS * KERNEL_ELEMENTS;
+    DebugLogger.log("\tget: %.2f ns via FArray.get -> %.2f ns via FARRAY_AT per element",
+                    ns[0] / per, ns[1] / per);
+    FArray.dispose(arr);
+}
+
+// locate the last element with the get + memcmp loop callers wrote, then with FArray.find
+static void find_at_stride(usize stride) {
+    farray arr = FArray.new(KERNEL_ELEMENTS, stride);
+    Assert.isNotNull(arr, "FArray creation failed");
+    char *value = calloc(1, stride);
+    char *out = calloc(1, stride);
+    for (usize i = 0; i < KERNEL_ELEMENTS; i++) {
+        value[0] = (char)(i % 100 + 1);
+        FArray.set(arr, i, stride, value);
+    }
+    value[0] = (char)101;  // only the last element matches
+    FArray.set(arr, KERNEL_ELEMENTS - 1, stride, value);
+    struct timespec start, end;
+    int found[2] = {-1, -1};
+    double ns[2];
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (usize r = 0; r < KERNEL_ROUNDS; r++) {
+        found[0] = -1;
+        for (usize i = 0; i < KERNEL_ELEMENTS; i++) {
+            FArray.get(arr, i, stride, out);
+            if (memcmp(out, value, stride) == 0) {
+                found[0] = (int)i;
+                break;
+            }
+        }
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    ns[0] = elapsed_ns(&start, &end);
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (usize r = 0; r < KERNEL_ROUNDS; r++) {
+        found[1] = FArray.find(arr, stride, value, 0);
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    ns[1] = elapsed_ns(&start, &end);
+
+    Assert.areEqual(&found[0], &found[1], INT, "Loop and find should agree");
+    double per = (double)KERNEL_ROUNDS * KERNEL_ELEMENTS;
+    DebugLogger.log("\tstride %2zu: find %.3f ns via get+memcmp -> %.3f ns via FArray.find per element",
+                    stride, ns[0] / per, ns[1] / per);
+
+    free(value);
+    free(out);
+    FArray.dispose(arr);
+}
+
+static void test_array_kernels_find(void) {
+    find_at_stride(1);
+    find_at_stride(4);
+    find_at_stride(8);
+    find_at_stride(24);
+}
+
+static void test_array_kernels_4(void) {
+    kernels_at_stride(4);
+}
+static void test_array_kernels_16(void) {
+    kernels_at_stride(16);
+}
+static void test_array_kernels_64(void) {
+    kernels_at_stride(64);
+}
+static void test_array_kernels_generic(void) {
+    kernels_at_stride(24);
+}
+
+//  register test cases
+static void register_array_kernels_tests(void) {
+    testset("perf_array_kernels_set", set_config, set_teardown);
+    DebugLogger.log("Test Source: %s", __FILE__);
+
+    testcase("array_kernels: stride 4", test_array_kernels_4);
+    testcase("array_kernels: stride 16", test_array_kernels_16);
+    testcase("array_kernels: stride 64", test_array_kernels_64);
+    testcase("array_kernels: stride 24 (generic)", test_array_kernels_generic);
+    testcase("array_kernels: unchecked access", test_array_kernels_fast_access);
+    testcase("array_kernels: find", test_array_kernels_find);
+}
+__attribute__((constructor)) static void enqueue_array_kernels_tests(void) {
+    Tests.enqueue(register_array_kernels_tests);
+}
@@ -0,0 +1,127 @@
+/*
+ *  Test File: test_bucket_alignment.c
+ *  Description: Random-access cost and dTLB misses for page- vs huge-page-aligned FArray buckets
+ */
+
+#define _GNU_SOURCE  // syscall, perf_event_open
+
+#include <sigma.test/sigtest.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "farray.h"
+#include "internal/arrays.h"
+#include "internal/collections.h"
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#endif
+
+#define TLB_ELEMENTS ((usize)16 << 20)  // 16M x 8 bytes = 128 MiB, far past the 4 KiB-page TLB reach
+#define TLB_STEPS ((usize)4 << 20)
+
+//  configure test set
+static void set_config(FILE **log_stream) {
+    *log_stream = fopen("logs/test_bucket_alignment.log", "w");
+}
+static void set_teardown(void) {
+}
+
+static double elapsed_ns(struct timespec *start, struct timespec *end) {
+    return (double)(end->tv_sec - start->tv_sec) * 1e9 + (double)(end->tv_nsec - start->tv_nsec);
+}
+
+// dTLB read-miss counter for this thread, or -1 where perf events are unavailable
+static int tlb_counter_open(void) {
+#if defined(__linux__)
+    struct perf_event_attr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = PERF_TYPE_HW_CACHE;
+    attr.config = PERF_COUNT_HW_CACHE_DTLB | (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+                  (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    return (int)syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+#else
+    return -1;
+#endif
+}
+
+static long long tlb_counter_read(int fd) {
+    long long count = -1;
+    if (fd < 0 || read(fd, &count, sizeof(count)) != (ssize_t)sizeof(count)) {
+        return -1;
+    }
+    return count;
+}
+
+// chase a single random cycle through the bucket: every step is a dependent random load
+static void chase_with_alignment(usize alignment, const char *label) {
+    farray arr = FArray.new_aligned(TLB_ELEMENTS, sizeof(uint64_t), alignment);
+    Assert.isNotNull(arr, "FArray.new_aligned failed");
+    uint64_t *next = farray_get_bucket(arr);
+
+    // Sattolo's shuffle yields one cycle covering every element
+    for (usize i = 0; i < TLB_ELEMENTS; i++) {
+        next[i] = i;
+    }
+    uint64_t seed = 88172645463325252ull;
+    for (usize i = TLB_ELEMENTS - 1; i > 0; i--) {
+        seed ^= seed << 13;
+        seed ^= seed >> 7;
+        seed ^= seed << 17;
+        usize j = (usize)(seed % i);
+        uint64_t swap = next[i];
+        next[i] = next[j];
+        next[j] = swap;
+    }
+
+    int fd = tlb_counter_open();
+    long long misses_before = tlb_counter_read(fd);
+    struct timespec start, end;
+    uint64_t at = 0;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (usize s = 0; s < TLB_STEPS; s++) {
+        at = next[at];
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    long long misses_after = tlb_counter_read(fd);
+    if (fd >= 0) {
+        close(fd);
+    }
+
+    Assert.isTrue(at < TLB_ELEMENTS, "Chase left the bucket");
+    if (misses_before >= 0 && misses_after >= 0) {
+        DebugLogger.log("\t%-10s (%s): %.1f ns per access, %.3f dTLB misses per access", label,
+                        array_bucket_is_mapped(next) ? "mapped" : "heap",
+                        elapsed_ns(&start, &end) / TLB_STEPS,
+                        (double)(misses_after - misses_before) / TLB_STEPS);
+    } else {
+        DebugLogger.log("\t%-10s (%s): %.1f ns per access (dTLB counter unavailable)", label,
+                        array_bucket_is_mapped(next) ? "mapped" : "heap",
+                        elapsed_ns(&start, &end) / TLB_STEPS);
+    }
+    FArray.dispose(arr);
+}
+
+static void test_bucket_alignment_page(void) {
+    chase_with_alignment(SC_ALIGN_PAGE, "page");
+}
+static void test_bucket_alignment_huge(void) {
+    chase_with_alignment(SC_ALIGN_HUGE_PAGE, "huge page");
+}
+
+//  register test cases
+static void register_bucket_alignment_tests(void) {
+    testset("perf_bucket_alignment_set", set_config, set_teardown);
+    DebugLogger.log("Test Source: %s", __FILE__);
+
+    testcase("bucket_alignment: 4 KiB pages", test_bucket_alignment_page);
+    testcase("bucket_alignment: 2 MiB huge pages", test_bucket_alignment_huge);
+}
+__attribute__((constructor)) static void enqueue_bucket_alignment_tests(void) {
+    Tests.enqueue(register_bucket_alignment_tests);
+}
@@ -0,0 +1,89 @@
+/*
+ *  Test File: test_slotarray_churn.c
+ *  Description: Add/remove churn benchmark for SlotArray at several fill ratios
+ */
+
+#define _POSIX_C_SOURCE 199309L  // clock_gettime
+
+#include <sigma.test/sigtest.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "slotarray.h"
+
+#define CHURN_CAPACITY 65536
+#define CHURN_ROUNDS 1000000
+
+static int churn_values[CHURN_CAPACITY];
+
+//  configure test set
+static void set_config(FILE **log_stream) {
+    *log_stream = fopen("logs/test_slotarray_churn.log", "w");
+}
+static void set_teardown(void) {
+}
+
+static double elapsed_ns(struct timespec *start, struct timespec *end) {
+    return (double)(end->tv_sec - start->tv_sec) * 1e9 + (double)(end->tv_nsec - start->tv_nsec);
+}
+
+// fill to `percent` of capacity, then repeatedly remove a pseudo-random occupied slot and re-add
+static void churn_at_fill(usize percent) {
+    slotarray sa = SlotArray.new(CHURN_CAPACITY);
+    usize live = CHURN_CAPACITY * percent / 100;
+    int *handles = malloc(sizeof(int) * live);
+    Assert.isNotNull(handles, "Handle buffer allocation failed");
+
+    for (usize i = 0; i < live; i++) {
+        handles[i] = SlotArray.add(sa, &churn_values[i]);
+    }
+
+    uint32_t seed = 2463534242u;
+    int failures = 0;
+    struct timespec start, end;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (usize r = 0; r < CHURN_ROUNDS; r++) {
+        seed ^= seed << 13;
+        seed ^= seed >> 17;
+        seed ^= seed << 5;
+        usize pick = seed % live;
+        SlotArray.remove_at(sa, (usize)handles[pick]);
+        handles[pick] = SlotArray.add(sa, &churn_values[pick]);
+        failures += handles[pick] < 0;
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+
+    Assert.areEqual(&(int){0}, &failures, INT, "Re-add after remove should never fail");
+    DebugLogger.log("\tfill %3zu%%: %.1f ns per remove+add (%d rounds, capacity %d)", percent,
+                    elapsed_ns(&start, &end) / CHURN_ROUNDS, CHURN_ROUNDS, CHURN_CAPACITY);
+
+    free(handles);
+    SlotArray.dispose(sa);
+}
+
+static void test_slotarray_churn_10(void) {
+    churn_at_fill(10);
+}
+static void test_slotarray_churn_50(void) {
+    churn_at_fill(50);
+}
+static void test_slotarray_churn_90(void) {
+    churn_at_fill(90);
+}
+static void test_slotarray_churn_99(void) {
+    churn_at_fill(99);
+}
+
+//  register test cases
+static void register_slotarray_churn_tests(void) {
+    testset("perf_slotarray_churn_set", set_config, set_teardown);
+    DebugLogger.log("Test Source: %s", __FILE__);
+
+    testcase("slotarray_churn: 10% fill", test_slotarray_churn_10);
+    testcase("slotarray_churn: 50% fill", test_slotarray_churn_50);
+    testcase("slotarray_churn: 90% fill", test_slotarray_churn_90);
+    testcase("slotarray_churn: 99% fill", test_slotarray_churn_99);
+}
+__attribute__((constructor)) static void enqueue_slotarray_churn_tests(void) {
+    Tests.enqueue(register_slotarray_churn_tests);
+}
@@ -10,7 +10,31 @@
 #include <stdlib.h>
 #include <string.h>
 #include "farray.h"
+#include "indexarray.h"
 #include "list.h"
+#include "map.h"
+#include "slotarray.h"
+#include "soa_indexarray.h"
+
+// counting instance allocator for per-instance binding tests
+static int counted_allocs = 0;
+static int counted_releases = 0;
+static object counting_alloc(usize size) {
+    counted_allocs++;
+    return calloc(1, size ? size : 1);
+}
+static void counting_release(object ptr) {
+    counted_releases++;
+    free(ptr);
+}
+static sc_alloc_use_t counting_use = {
+    .alloc = counting_alloc,
+    .release = counting_release,
+};
+static void reset_counts(void) {
+    counted_allocs = 0;
+    counted_releases = 0;
+}
 
 //  configure test set
 static void set_config(FILE **log_stream) {
@@ -44,6 +68,98 @@ static void test_farray_with_allocator(void) {
     }
 }
 
+//  test per-instance allocator binding
+static void test_list_new_with_growth(void) {
+    reset_counts();
+    list lst = List.new_with(&counting_use, 2, sizeof(addr));
+    Assert.isNotNull(lst, "List.new_with ERRed");
+    int allocs_before_growth = counted_allocs;
+
+    int values[5] = {1, 2, 3, 4, 5};
+    for (int i = 0; i < 5; i++) {
+        List.append(lst, &values[i]);
+    }
+    Assert.isTrue(counted_allocs > allocs_before_growth, "Growth should use instance allocator");
+
+    List.dispose(lst);
+    Assert.areEqual(&counted_allocs, &counted_releases, INT, "List allocations leaked");
+}
+
+static void test_map_new_with_rehash(void) {
+    reset_counts();
+    map m = Map.new_with(&counting_use, 8);
+    Assert.isNotNull(m, "Map.new_with ERRed");
+
+    static const char *keys[] = {"a", "b", "c", "d", "e", "f", "g", "h", "i", "j"};
+    for (usize i = 0; i < 10; i++) {
+        Map.set(m, keys[i], 1, i);
+    }
+    Assert.isTrue(Map.capacity(m) > 8, "Map should have rehashed");
+
+    int allocs_before_iter = counted_allocs;
+    sparse_iterator it = Map.create_iterator(m);
+    Assert.areEqual(&(int){allocs_before_iter + 1}, &counted_allocs, INT,
+                    "Iterator should use instance allocator");
+    SparseIterator.dispose(it);
+
+    Map.dispose(m);
+    Assert.areEqual(&counted_allocs, &counted_releases, INT, "Map allocations leaked");
+}
+
+static void test_sparse_new_with(void) {
+    reset_counts();
+    indexarray ia = IndexArray.new_with(&counting_use, 1, sizeof(int));
+    slotarray sa = SlotArray.new_with(&counting_use, 4);
+    Assert.isNotNull(ia, "IndexArray.new_with ERRed");
+    Assert.isNotNull(sa, "SlotArray.new_with ERRed");
+
+    int values[3] = {7, 8, 9};
+    for (int i = 0; i < 3; i++) {
+        IndexArray.add(ia, &values[i]);
+        SlotArray.add(sa, &values[i]);
+    }
+    sparse_iterator it = SlotArray.create_iterator(sa);
+    SparseIterator.dispose(it);
+
+    IndexArray.dispose(ia);
+    SlotArray.dispose(sa);
+    Assert.isTrue(counted_allocs > 0, "Instance allocator was not used");
+    Assert.areEqual(&counted_allocs, &counted_releases, INT, "Sparse allocations leaked");
+}
+
+static void test_farray_new_epoch_with(void) {
+    reset_counts();
+    farray arr = FArray.new_epoch_with(&counting_use, 4, sizeof(int));
+    Assert.isNotNull(arr, "FArray.new_epoch_with ERRed");
+    int allocs_before_growth = counted_allocs;
+
+    int value = 9;
+    FArray.reserve(arr, 16, sizeof(int));
+    FArray.set(arr, 12, sizeof(int), &value);
+    Assert.isTrue(counted_allocs > allocs_before_growth,
+                  "Bucket and epoch growth should use instance allocator");
+
+    FArray.dispose(arr);
+    Assert.areEqual(&counted_allocs, &counted_releases, INT, "FArray allocations leaked");
+}
+
+static void test_soa_new_split_with(void) {
+    reset_counts();
+    soa_indexarray sa =
+        SoaIndexArray.new_split_with(&counting_use, 2, 4 * sizeof(int), sizeof(int));
+    Assert.isNotNull(sa, "SoaIndexArray.new_split_with ERRed");
+    int allocs_before_growth = counted_allocs;
+
+    int record[4] = {1, 2, 3, 4};
+    for (int i = 0; i < 5; i++) {
+        SoaIndexArray.add(sa, record);
+    }
+    Assert.isTrue(counted_allocs > allocs_before_growth, "Growth should use instance allocator");
+
+    SoaIndexArray.dispose(sa);
+    Assert.areEqual(&counted_allocs, &counted_releases, INT, "SoaIndexArray allocations leaked");
+}
+
 //  register test cases
 static void register_collections_allocator_tests(void) {
     testset("collections_allocator_set", set_config, set_teardown);
@@ -51,6 +167,11 @@ static void register_collections_allocator_tests(void) {
 
     testcase("list_with_allocator", test_list_with_allocator);
     testcase("farray_with_allocator", test_farray_with_allocator);
+    testcase("list_new_with_growth", test_list_new_with_growth);
+    testcase("map_new_with_rehash", test_map_new_with_rehash);
+    testcase("sparse_new_with", test_sparse_new_with);
+    testcase("farray_new_epoch_with", test_farray_new_epoch_with);
+    testcase("soa_new_split_with", test_soa_new_split_with);
 }
 __attribute__((constructor)) static void enqueue_collections_allocator_tests(void) {
     Tests.enqueue(register_collections_allocator_tests);
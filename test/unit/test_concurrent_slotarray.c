@@ -0,0 +1,125 @@
+/*
+ *  Test File: test_concurrent_slotarray.c
+ *  Description: Test cases for ConcurrentSlotArray collection
+ */
+
+#include <sigma.test/sigtest.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "collections.h"
+#include "concurrent_slotarray.h"
+
+#define CSA_THREADS 4
+#define CSA_ROUNDS 20000
+#define CSA_HELD 64
+
+//  configure test set
+static void set_config(FILE **log_stream) {
+    *log_stream = fopen("logs/test_concurrent_slotarray.log", "w");
+}
+static void set_teardown(void) {}
+
+static void test_csa_add_get_remove(void) {
+    concurrent_slotarray csa = ConcurrentSlotArray.new(4);
+    Assert.isNotNull(csa, "ConcurrentSlotArray creation failed");
+    Assert.areEqual(&(usize){8}, &(usize){ConcurrentSlotArray.capacity(csa)}, LONG,
+                    "First segment should be rounded up to 8");
+
+    // fill past the first segment: indices stay stable as segments are appended
+    int values[20];
+    int handles[20];
+    for (int i = 0; i < 20; i++) {
+        handles[i] = ConcurrentSlotArray.add(csa, &values[i]);
+        Assert.isTrue(handles[i] >= 0, "Add %d failed", i);
+    }
+    Assert.areEqual(&(usize){24}, &(usize){ConcurrentSlotArray.capacity(csa)}, LONG,
+                    "Two segments (8 + 16) expected");
+    for (int i = 0; i < 20; i++) {
+        object out;
+        ConcurrentSlotArray.get_at(csa, handles[i], &out);
+        Assert.areEqual(&values[i], out, PTR, "Handle %d lost its value", i);
+    }
+
+    Assert.areEqual(&(int){OK}, &(int){ConcurrentSlotArray.remove_at(csa, handles[5])}, INT,
+                    "Remove failed");
+    Assert.areEqual(&(int){ERR}, &(int){ConcurrentSlotArray.remove_at(csa, handles[5])}, INT,
+                    "Second remove of the same slot should fail");
+    Assert.isTrue(ConcurrentSlotArray.is_empty_slot(csa, handles[5]), "Slot should be empty");
+    int reused = ConcurrentSlotArray.add(csa, &values[5]);
+    Assert.areEqual(&handles[5], &reused, INT, "Freed slot should be reused first");
+
+    ConcurrentSlotArray.dispose(csa);
+}
+
+typedef struct csa_worker {
+    concurrent_slotarray csa;
+    int id;
+    int errors;
+} csa_worker;
+
+// each thread churns its own set of handles and checks nobody else wrote into them
+static void *csa_churn(void *arg) {
+    csa_worker *w = arg;
+    int tokens[CSA_HELD];
+    int held[CSA_HELD];
+    for (int i = 0; i < CSA_HELD; i++) {
+        tokens[i] = w->id;
+        held[i] = ConcurrentSlotArray.add(w->csa, &tokens[i]);
+        w->errors += held[i] < 0;
+    }
+    for (int r = 0; r < CSA_ROUNDS; r++) {
+        int pick = r % CSA_HELD;
+        object out = NULL;
+        if (ConcurrentSlotArray.get_at(w->csa, held[pick], &out) != OK || out != &tokens[pick]) {
+            w->errors++;
+        }
+        w->errors += ConcurrentSlotArray.remove_at(w->csa, held[pick]) != OK;
+        held[pick] = ConcurrentSlotArray.add(w->csa, &tokens[pick]);
+        w->errors += held[pick] < 0;
+    }
+    for (int i = 0; i < CSA_HELD; i++) {
+        w->errors += ConcurrentSlotArray.remove_at(w->csa, held[i]) != OK;
+    }
+    return NULL;
+}
+
+static void test_csa_concurrent_churn(void) {
+    concurrent_slotarray csa = ConcurrentSlotArray.new(8);  // forces concurrent growth
+    pthread_t threads[CSA_THREADS];
+    csa_worker workers[CSA_THREADS];
+
+    for (int t = 0; t < CSA_THREADS; t++) {
+        workers[t] = (csa_worker){csa, t, 0};
+        pthread_create(&threads[t], NULL, csa_churn, &workers[t]);
+    }
+    int errors = 0;
+    for (int t = 0; t < CSA_THREADS; t++) {
+        pthread_join(threads[t], NULL);
+        errors += workers[t].errors;
+    }
+    Assert.areEqual(&(int){0}, &errors, INT, "Handles were shared or lost between threads");
+
+    // every slot is back on the free stack
+    usize capacity = ConcurrentSlotArray.capacity(csa);
+    usize occupied = 0;
+    for (usize i = 0; i < capacity; i++) {
+        occupied += !ConcurrentSlotArray.is_empty_slot(csa, i);
+    }
+    Assert.areEqual(&(usize){0}, &occupied, LONG, "All slots should be empty after churn");
+
+    ConcurrentSlotArray.dispose(csa);
+}
+
+//  register test cases
+static void register_concurrent_slotarray_tests(void) {
+    testset("core_concurrent_slotarray_set", set_config, set_teardown);
+    DebugLogger.log("Test Source: %s", __FILE__);
+
+    testcase("concurrent_slotarray_add_get_remove", test_csa_add_get_remove);
+    testcase("concurrent_slotarray_churn", test_csa_concurrent_churn);
+}
+__attribute__((constructor)) static void enqueue_concurrent_slotarray_tests(void) {
+    Tests.enqueue(register_concurrent_slotarray_tests);
+}
@@ -8,12 +8,21 @@
  *  where memory efficiency is important.
  */
 
+#define _DEFAULT_SOURCE  // truncate
+
 #include <sigma.test/sigtest.h>
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <unistd.h>
 #include "collections.h"
 #include "farray.h"
+#include "internal/array_base.h"
+#include "internal/arrays.h"
+#include "internal/collections.h"
+#include "parray.h"
+#include "sc_fast.h"
 
 //  configure test set
 static void set_config(FILE **log_stream) {
@@ -106,6 +115,93 @@ static void test_farray_clear(void) {
 
     FArray.dispose(arr);
 }
+static void test_farray_epoch_clear(void) {
+    usize element_size = sizeof(int);
+    farray arr = FArray.new_epoch(8, element_size);
+    Assert.isNotNull(arr, "FArray epoch creation ERRed");
+
+    for (int i = 0; i < 8; i++) {
+        int value = (i + 1) * 11;
+        FArray.set(arr, i, element_size, &value);
+    }
+
+    // clear only advances the epoch; every slot must now read as zero
+    FArray.clear(arr, element_size);
+    for (int i = 0; i < 8; i++) {
+        int value = -1;
+        int result = FArray.get(arr, i, element_size, &value);
+        Assert.areEqual(&(int){0}, &result, INT, "Get after epoch clear ERRed at index %d", i);
+        Assert.areEqual(&(int){0}, &value, INT, "Stale value visible at index %d", i);
+    }
+
+    // a write reclaims the stale slot
+    int fresh = 77;
+    FArray.set(arr, 3, element_size, &fresh);
+    int value = 0;
+    FArray.get(arr, 3, element_size, &value);
+    Assert.areEqual(&fresh, &value, INT, "Rewritten slot mismatch after epoch clear");
+
+    // raw collection copies see the cleared state too
+    collection coll = FArray.to_collection(arr, element_size);
+    Assert.isNotNull(coll, "FArray to_collection ERRed");
+    iterator it = Collections.create_iterator(coll);
+    int index = 0;
+    while (Iterator.next(it)) {
+        int expected = index == 3 ? fresh : 0;
+        Assert.areEqual(&expected, (int *)Iterator.current(it), INT,
+                        "Collection copy mismatch at index %d", index);
+        index++;
+    }
+
+    Iterator.dispose(it);
+    Collections.dispose(coll);
+    FArray.dispose(arr);
+}
+static void test_farray_epoch_scans(void) {
+    usize element_size = sizeof(int);
+    farray arr = FArray.new_epoch(8, element_size);
+    Assert.isNotNull(arr, "FArray epoch creation ERRed");
+
+    for (int i = 0; i < 8; i++) {
+        int value = i + 1;
+        FArray.set(arr, i, element_size, &value);
+    }
+    FArray.clear(arr, element_size);
+    int three = 3;
+    FArray.set(arr, 5, element_size, &three);
+
+    // scans see stale slots as zero without rewriting the bucket
+    int zero = 0;
+    Assert.areEqual(&(int){5}, &(int){FArray.find(arr, element_size, &three, 0)}, INT,
+                    "Find should skip the stale 3 at index 2");
+    Assert.areEqual(&(int){0}, &(int){FArray.find(arr, element_size, &zero, 0)}, INT,
+                    "Stale slot should match zero");
+    Assert.areEqual(&(usize){7}, &(usize){FArray.count_eq(arr, element_size, &zero)}, LONG,
+                    "Stale slots should count as zero");
+    Assert.areEqual(&(usize){1}, &(usize){FArray.count_eq(arr, element_size, &three)}, LONG,
+                    "Only the live 3 should count");
+
+    struct spoofed_farray {
+        char handle[2];
+        void *bucket;
+        void *end;
+    } *spoofed = (struct spoofed_farray *)arr;
+    int raw = 0;
+    memcpy(&raw, spoofed->bucket, element_size);
+    Assert.areEqual(&(int){1}, &raw, INT, "Scans should not write stale slots");
+
+    // compact moves the live value down and retires the tail by stamp
+    Assert.areEqual(&(usize){1}, &(usize){farray_compact(arr, element_size)}, LONG,
+                    "Compact should keep one live value");
+    for (int i = 0; i < 8; i++) {
+        int value = -1;
+        FArray.get(arr, i, element_size, &value);
+        int expected = i == 0 ? three : 0;
+        Assert.areEqual(&expected, &value, INT, "Compacted value mismatch at index %d", i);
+    }
+
+    FArray.dispose(arr);
+}
 static void test_farray_set_value(void) {
     int initial_capacity = 10;
     usize element_size = sizeof(int);
@@ -245,6 +341,307 @@ static void test_farray_remove_out_of_bounds(void) {
     FArray.dispose(arr);
 }
 
+// every kernel level the CPU supports must compact and test emptiness identically
+static void test_farray_simd_kernels(void) {
+    static const usize strides[] = {1, 2, 4, 8, 24};
+    usize count = 37;  // not a multiple of any vector width, so tails are exercised
+    unsigned char element[24];
+    int saved = array_simd_select(ARRAY_SIMD_AVX2);
+
+    for (int level = ARRAY_SIMD_SCALAR; level <= array_simd_supported(); level++) {
+        array_simd_select(level);
+        for (usize s = 0; s < sizeof(strides) / sizeof(strides[0]); s++) {
+            usize stride = strides[s];
+            farray arr = FArray.new(count, stride);
+            for (usize i = 0; i < count; i++) {
+                memset(element, 0, sizeof(element));
+                if (i % 3 != 0) {
+                    element[stride - 1] = (unsigned char)i;  // only the last byte is set
+                }
+                FArray.set(arr, i, stride, element);
+            }
+
+            usize live = farray_compact(arr, stride);
+            Assert.areEqual(&(usize){24}, &live, LONG, "Level %d stride %zu: wrong survivor count",
+                            level, stride);
+            usize expected = 1;
+            for (usize i = 0; i < count; i++) {
+                FArray.get(arr, i, stride, element);
+                if (i >= live) {
+                    Assert.isTrue(array_simd_is_zero(element, stride),
+                                  "Level %d stride %zu: vacated slot %zu should be zero", level, stride, i);
+                    continue;
+                }
+                Assert.areEqual(&(int){(int)expected}, &(int){element[stride - 1]}, INT,
+                                "Level %d stride %zu: survivor %zu out of order", level, stride, i);
+                expected += (expected % 3 == 2) ? 2 : 1;
+            }
+            FArray.dispose(arr);
+        }
+
+        // a single dirty byte anywhere in a long span is found
+        unsigned char span[300] = {0};
+        Assert.isTrue(array_simd_is_zero(span, sizeof(span)), "Level %d: zero span", level);
+        for (usize i = 0; i < sizeof(span); i += 7) {
+            span[i] = 1;
+            Assert.isTrue(!array_simd_is_zero(span, sizeof(span)), "Level %d: missed byte %zu", level, i);
+            span[i] = 0;
+        }
+    }
+    array_simd_select(saved);
+}
+
+// buckets start on the requested boundary, and growth keeps both boundary and contents
+static void test_farray_aligned(void) {
+    static const usize alignments[] = {SC_ALIGN_AUTO, SC_ALIGN_CACHE_LINE, SC_ALIGN_PAGE,
+                                       SC_ALIGN_HUGE_PAGE};
+    for (usize a = 0; a < sizeof(alignments) / sizeof(alignments[0]); a++) {
+        usize boundary = alignments[a] ? alignments[a] : SC_ALIGN_CACHE_LINE;
+        farray arr = FArray.new_aligned(100, sizeof(int), alignments[a]);
+        Assert.isNotNull(arr, "new_aligned(%zu) failed", alignments[a]);
+        Assert.isTrue((uintptr_t)farray_get_bucket(arr) % boundary == 0, "Bucket not %zu-aligned",
+                      boundary);
+        for (int i = 0; i < 100; i++) {
+            FArray.set(arr, i, sizeof(int), &i);
+        }
+
+        Assert.areEqual(&(int){OK}, &(int){farray_resize_bucket(arr, sizeof(int), 5000)}, INT,
+                        "Resize failed");
+        Assert.isTrue((uintptr_t)farray_get_bucket(arr) % boundary == 0,
+                      "Resized bucket lost its %zu alignment", boundary);
+        for (int i = 0; i < 100; i++) {
+            int out = -1;
+            FArray.get(arr, i, sizeof(int), &out);
+            Assert.areEqual(&i, &out, INT, "Value %d lost in resize", i);
+        }
+        FArray.dispose(arr);
+    }
+
+    Assert.isTrue(FArray.new_aligned(10, sizeof(int), 48) == NULL,
+                  "Non power-of-two alignment should be rejected");
+}
+
+// find, find_any and count_eq agree with a scalar scan at every kernel level and stride
+static void test_farray_find(void) {
+    static const usize strides[] = {1, 2, 4, 8, 12};
+    const usize capacity = 100;
+    for (int level = ARRAY_SIMD_SCALAR; level <= array_simd_supported(); level++) {
+        array_simd_select(level);
+        for (usize s = 0; s < sizeof(strides) / sizeof(strides[0]); s++) {
+            usize stride = strides[s];
+            farray arr = FArray.new(capacity, stride);
+            unsigned char value[12] = {0};
+            // element i holds (i % 7) + 1 in its last byte; 0..49 only, so the tail stays empty
+            for (usize i = 0; i < 50; i++) {
+                value[stride - 1] = (unsigned char)(i % 7 + 1);
+                FArray.set(arr, i, stride, value);
+            }
+
+            value[stride - 1] = 5;
+            Assert.areEqual(&(int){4}, &(int){FArray.find(arr, stride, value, 0)}, INT,
+                            "level %d stride %zu: first 5", level, stride);
+            Assert.areEqual(&(int){39}, &(int){FArray.find(arr, stride, value, 33)}, INT,
+                            "level %d stride %zu: 5 from 33", level, stride);
+            Assert.areEqual(&(usize){7}, &(usize){FArray.count_eq(arr, stride, value)}, LONG,
+                            "level %d stride %zu: count of 5", level, stride);
+            value[stride - 1] = 9;
+            Assert.areEqual(&(int){-1}, &(int){FArray.find(arr, stride, value, 0)}, INT,
+                            "level %d stride %zu: missing value", level, stride);
+
+            unsigned char empty[12] = {0};
+            Assert.areEqual(&(int){50}, &(int){FArray.find(arr, stride, empty, 0)}, INT,
+                            "level %d stride %zu: first empty", level, stride);
+            Assert.areEqual(&(usize){50}, &(usize){FArray.count_eq(arr, stride, empty)}, LONG,
+                            "level %d stride %zu: empty count", level, stride);
+
+            unsigned char any[3 * 12] = {0};
+            any[stride - 1] = 9;
+            any[2 * stride - 1] = 7;
+            any[3 * stride - 1] = 3;
+            Assert.areEqual(&(int){6}, &(int){FArray.find_any(arr, stride, any, 3, 3)}, INT,
+                            "level %d stride %zu: find_any", level, stride);
+            FArray.dispose(arr);
+        }
+    }
+    array_simd_select(array_simd_supported());
+}
+
+// resize keeps contents and zeroes only the new tail; reserve never shrinks
+static void test_farray_resize(void) {
+    farray arr = FArray.new(8, sizeof(int));
+    for (int i = 0; i < 8; i++) {
+        FArray.set(arr, i, sizeof(int), &i);
+    }
+    Assert.areEqual(&(int){OK}, &(int){FArray.resize(arr, 1000, sizeof(int))}, INT, "Resize failed");
+    Assert.areEqual(&(int){1000}, &(int){FArray.capacity(arr, sizeof(int))}, INT,
+                    "Capacity mismatch after resize");
+    for (int i = 0; i < 8; i++) {
+        int out = -1;
+        FArray.get(arr, i, sizeof(int), &out);
+        Assert.areEqual(&i, &out, INT, "Value %d lost in resize", i);
+    }
+    int out = -1;
+    FArray.get(arr, 999, sizeof(int), &out);
+    Assert.areEqual(&(int){0}, &out, INT, "New tail should be zeroed");
+
+    Assert.areEqual(&(int){OK}, &(int){FArray.reserve(arr, 10, sizeof(int))}, INT, "Reserve failed");
+    Assert.areEqual(&(int){1000}, &(int){FArray.capacity(arr, sizeof(int))}, INT,
+                    "Reserve should not shrink");
+    Assert.areEqual(&(int){OK}, &(int){FArray.reserve(arr, 4000, sizeof(int))}, INT, "Reserve failed");
+    Assert.areEqual(&(int){4000}, &(int){FArray.capacity(arr, sizeof(int))}, INT,
+                    "Capacity mismatch after reserve");
+    // capacity is reported as int, so larger sizes are refused before any allocation
+    Assert.areEqual(&(int){ERR}, &(int){FArray.resize(arr, (usize)INT32_MAX + 1, 1)}, INT,
+                    "Capacity above INT_MAX should be rejected");
+    Assert.areEqual(&(int){4000}, &(int){FArray.capacity(arr, sizeof(int))}, INT,
+                    "Rejected resize changed the array");
+    FArray.dispose(arr);
+
+    // the epoch shadow follows the bucket both ways; a cleared slot stays empty across a shrink
+    arr = FArray.new_epoch(64, sizeof(int));
+    for (int i = 0; i < 64; i++) {
+        FArray.set(arr, i, sizeof(int), &i);
+    }
+    Assert.areEqual(&(int){OK}, &(int){FArray.resize(arr, 256, sizeof(int))}, INT, "Epoch grow failed");
+    FArray.clear(arr, sizeof(int));
+    FArray.set(arr, 5, sizeof(int), &(int){55});
+    Assert.areEqual(&(int){OK}, &(int){FArray.resize(arr, 16, sizeof(int))}, INT,
+                    "Epoch shrink failed");
+    FArray.get(arr, 5, sizeof(int), &out);
+    Assert.areEqual(&(int){55}, &out, INT, "Live epoch slot lost in shrink");
+    out = -1;
+    FArray.get(arr, 6, sizeof(int), &out);
+    Assert.areEqual(&(int){0}, &out, INT, "Stale epoch slot should read empty after shrink");
+    FArray.dispose(arr);
+
+    // huge-page buckets grow by extending their mapping
+    arr = FArray.new_aligned(16, sizeof(int), SC_ALIGN_HUGE_PAGE);
+    for (int i = 0; i < 16; i++) {
+        FArray.set(arr, i, sizeof(int), &i);
+    }
+    Assert.areEqual(&(int){OK}, &(int){FArray.resize(arr, 2 * 1024 * 1024, sizeof(int))}, INT,
+                    "Huge resize failed");
+    FArray.get(arr, 15, sizeof(int), &out);
+    Assert.areEqual(&(int){15}, &out, INT, "Value lost in huge resize");
+    FArray.get(arr, 2 * 1024 * 1024 - 1, sizeof(int), &out);
+    Assert.areEqual(&(int){0}, &out, INT, "Huge tail should be zeroed");
+    FArray.dispose(arr);
+}
+
+// unchecked accessors see the same storage as the checked interface
+static void test_farray_fast_access(void) {
+    farray arr = FArray.new(32, sizeof(int));
+    Assert.areEqual(&(usize){32}, &(usize){farray_capacity_unchecked(arr, sizeof(int))}, LONG,
+                    "Unchecked capacity mismatch");
+    for (int i = 0; i < 32; i++) {
+        FARRAY_AT(arr, int, i) = i * 3;
+    }
+    for (int i = 0; i < 32; i++) {
+        int out = -1;
+        FArray.get(arr, i, sizeof(int), &out);
+        Assert.areEqual(&(int){i * 3}, &out, INT, "Unchecked store %d not visible", i);
+    }
+    FArray.set(arr, 7, sizeof(int), &(int){-7});
+    Assert.areEqual(&(int){-7}, (int *)farray_ptr_unchecked(arr, 7, sizeof(int)), INT,
+                    "Checked store not visible to unchecked load");
+    Assert.isTrue(farray_data(arr) == farray_get_bucket(arr), "Data pointer mismatch");
+    FArray.dispose(arr);
+
+    parray parr = PArray.new(16);
+    Assert.areEqual(&(usize){16}, &(usize){parray_capacity_unchecked(parr)}, LONG,
+                    "Unchecked PArray capacity mismatch");
+    parray_store(parr, 15, (addr)0xbeef);
+    addr value = ADDR_EMPTY;
+    PArray.get(parr, 15, &value);
+    Assert.isTrue(value == (addr)0xbeef, "Unchecked PArray store not visible");
+    PArray.set(parr, 3, (addr)0xf00d);
+    Assert.isTrue(parray_load(parr, 3) == (addr)0xf00d, "Checked PArray store not visible");
+    Assert.isTrue(parray_load(parr, 4) == ADDR_EMPTY, "Empty slot should load ADDR_EMPTY");
+    PArray.dispose(parr);
+}
+
+// save, then map read-only and read-write; two mappings of one file share their pages
+static void test_farray_map_file(void) {
+    const char *path = "logs/test_farray_map.bin";
+    farray arr = FArray.new(64, sizeof(int));
+    for (int i = 0; i < 64; i++) {
+        int value = i * i;
+        FArray.set(arr, i, sizeof(int), &value);
+    }
+    Assert.areEqual(&(int){OK}, &(int){FArray.save_file(arr, path, sizeof(int))}, INT, "Save failed");
+    FArray.dispose(arr);
+
+    Assert.isTrue(FArray.map_file(path, sizeof(long long), FARRAY_MAP_READ) == NULL,
+                  "Stride mismatch should be rejected");
+    farray ro = FArray.map_file(path, sizeof(int), FARRAY_MAP_READ);
+    Assert.isNotNull(ro, "Read-only map failed");
+    Assert.areEqual(&(int){64}, &(int){FArray.capacity(ro, sizeof(int))}, INT, "Capacity is the count");
+    int out = 0;
+    FArray.get(ro, 9, sizeof(int), &out);
+    Assert.areEqual(&(int){81}, &out, INT, "Mapped value differs");
+    Assert.areEqual(&(int){ERR}, &(int){FArray.set(ro, 9, sizeof(int), &out)}, INT,
+                    "Read-only set should fail");
+    // neither a collection view nor compaction may write the read-only pages
+    collection view = FArray.as_collection(ro, sizeof(int));
+    Collections.clear(view);
+    Assert.areEqual(&(int){ERR}, &(int){Collections.remove(view, &out)}, INT,
+                    "Read-only view remove should fail");
+    Collections.dispose(view);
+    Assert.areEqual(&(usize){0}, &(usize){farray_compact(ro, sizeof(int))}, LONG,
+                    "Read-only compact should do nothing");
+    FArray.get(ro, 9, sizeof(int), &out);
+    Assert.areEqual(&(int){81}, &out, INT, "Read-only mapping was modified");
+
+    // a write through one mapping is visible through the other at once
+    farray rw = FArray.map_file(path, sizeof(int), FARRAY_MAP_WRITE);
+    Assert.isNotNull(rw, "Read-write map failed");
+    int value = -7;
+    Assert.areEqual(&(int){OK}, &(int){FArray.set(rw, 9, sizeof(int), &value)}, INT, "Set failed");
+    FArray.get(ro, 9, sizeof(int), &out);
+    Assert.areEqual(&value, &out, INT, "Shared mapping should see the store");
+    Assert.areEqual(&(int){OK}, &(int){FArray.sync(rw)}, INT, "Sync failed");
+    FArray.dispose(rw);
+    FArray.dispose(ro);
+
+    // the store persisted in the file
+    ro = FArray.map_file(path, sizeof(int), FARRAY_MAP_READ);
+    FArray.get(ro, 9, sizeof(int), &out);
+    Assert.areEqual(&value, &out, INT, "Store should persist after dispose");
+    FArray.dispose(ro);
+    remove(path);
+}
+
+// a header whose count does not fit the int capacity is rejected even when the file is large enough
+static void test_farray_map_file_count_limit(void) {
+    const char *path = "logs/test_farray_map_count.bin";
+    struct {
+        char magic[8];
+        uint32_t version;
+        uint32_t header_bytes;
+        uint64_t stride;
+        uint64_t count;
+    } header = {{'S', 'C', 'F', 'A', 'R', 'R', 'A', 'Y'}, 1, 4096, 1, (uint64_t)INT32_MAX + 1};
+    FILE *file = fopen(path, "wb");
+    Assert.isNotNull(file, "Could not create %s", path);
+    fwrite(&header, sizeof(header), 1, file);
+    fclose(file);
+    // sparse: the file is long enough for count stride-1 elements without using the space
+    Assert.areEqual(&(int){0}, &(int){truncate(path, 4096 + (off_t)header.count)}, INT,
+                    "Could not extend %s", path);
+
+    Assert.isTrue(FArray.map_file(path, 1, FARRAY_MAP_READ) == NULL,
+                  "Count above INT_MAX should be rejected");
+    header.count = 1024;  // the same file with a representable count maps
+    file = fopen(path, "r+b");
+    fwrite(&header, sizeof(header), 1, file);
+    fclose(file);
+    farray arr = FArray.map_file(path, 1, FARRAY_MAP_READ);
+    Assert.isNotNull(arr, "Valid header should map");
+    Assert.areEqual(&(int){1024}, &(int){FArray.capacity(arr, 1)}, INT, "Capacity is the count");
+    FArray.dispose(arr);
+    remove(path);
+}
+
 //  register test cases
 static void register_farray_tests(void) {
     testset("core_farray_set", set_config, set_teardown);
@@ -255,10 +652,19 @@ static void register_farray_tests(void) {
     testcase("farray_init_from_existing", test_farray_init_existing);
     testcase("farray_get_capacity", test_farray_get_capacity);
     testcase("farray_clear", test_farray_clear);
+    testcase("farray_epoch_clear", test_farray_epoch_clear);
+    testcase("farray_epoch_scans", test_farray_epoch_scans);
 
     testcase("farray_set_value", test_farray_set_value);
     testcase("farray_get_value", test_farray_get_value);
     testcase("farray_remove_at", test_farray_remove_at);
+    testcase("farray_simd_kernels", test_farray_simd_kernels);
+    testcase("farray_aligned", test_farray_aligned);
+    testcase("farray_map_file", test_farray_map_file);
+    testcase("farray_map_file_count_limit", test_farray_map_file_count_limit);
+    testcase("farray_resize", test_farray_resize);
+    testcase("farray_find", test_farray_find);
+    testcase("farray_fast_access", test_farray_fast_access);
 
     testcase("farray_as_collection", test_farray_as_collection);
     testcase("farray_to_collection", test_farray_to_collection);
@@ -142,6 +142,64 @@ static void test_indexarray_clear(void) {
     IndexArray.dispose(ia);
 }
 
+static void test_indexarray_clear_reuse(void) {
+    indexarray ia = IndexArray.new(4, sizeof(test_data));
+    Assert.isNotNull(ia, "IndexArray creation failed");
+
+    for (int i = 0; i < 4; i++) {
+        test_data data = {.id = i + 1, .value = i * 10};
+        IndexArray.add(ia, &data);
+    }
+
+    IndexArray.clear(ia);
+    for (usize i = 0; i < 4; i++) {
+        Assert.isTrue(IndexArray.is_empty_slot(ia, i), "Slot %zu should be empty after clear", i);
+        test_data retrieved = {0};
+        int result = IndexArray.get_at(ia, i, &retrieved);
+        Assert.areEqual(&(int){-1}, &result, INT, "Stale slot %zu should not be readable", i);
+    }
+
+    // stale slots are reused from the start, then growth keeps the bitmap in step
+    for (int i = 0; i < 6; i++) {
+        test_data data = {.id = 100 + i, .value = i};
+        int h = IndexArray.add(ia, &data);
+        Assert.areEqual(&i, &h, INT, "Add after clear returned unexpected handle");
+    }
+    Assert.isTrue(IndexArray.capacity(ia) > 4, "Capacity should have grown");
+    Assert.isTrue(IndexArray.is_empty_slot(ia, 6), "Grown slot should start empty");
+
+    test_data retrieved = {0};
+    IndexArray.get_at(ia, 5, &retrieved);
+    Assert.areEqual(&(int){105}, &retrieved.id, INT, "Grown slot data mismatch");
+
+    IndexArray.dispose(ia);
+}
+
+static void test_indexarray_zero_values(void) {
+    indexarray ia = IndexArray.new(4, sizeof(test_data));
+
+    // an all-zero value is a live value, not an empty slot
+    test_data zero = {0, 0};
+    int index = IndexArray.add(ia, &zero);
+    Assert.areEqual(&(int){0}, &index, INT, "Zero value should be added");
+    Assert.isFalse(IndexArray.is_empty_slot(ia, 0), "Zero value should occupy its slot");
+    Assert.areEqual(&(usize){1}, &(usize){IndexArray.count(ia)}, LONG, "Count should be 1");
+
+    test_data out = {9, 9};
+    Assert.areEqual(&(int){OK}, &(int){IndexArray.get_at(ia, 0, &out)}, INT, "Zero value should be readable");
+    Assert.areEqual(&(int){0}, &out.id, INT, "Zero value read back wrong");
+
+    // the next add skips the occupied zero slot
+    test_data one = {1, 1};
+    Assert.areEqual(&(int){1}, &(int){IndexArray.add(ia, &one)}, INT, "Add should skip the zero slot");
+
+    Assert.areEqual(&(int){OK}, &(int){IndexArray.remove_at(ia, 0)}, INT, "Remove failed");
+    Assert.isTrue(IndexArray.is_empty_slot(ia, 0), "Removed slot should be empty");
+    Assert.areEqual(&(usize){1}, &(usize){IndexArray.count(ia)}, LONG, "Count should be 1");
+
+    IndexArray.dispose(ia);
+}
+
 static void test_indexarray_slot_reuse(void) {
     indexarray ia = IndexArray.new(3, sizeof(test_data));
 
@@ -242,6 +300,46 @@ static void test_indexarray_from_farray(void) {
     FArray.dispose(arr);
 }
 
+static void test_indexarray_bulk_import_export(void) {
+    // long runs and gaps across several bitmap words
+    usize cap = 200;
+    farray arr = FArray.new(cap, sizeof(test_data));
+    int expected = 0;
+    for (usize i = 0; i < cap; i++) {
+        if (i % 7 != 3) {
+            test_data d = {(int)i + 1, (int)i};
+            FArray.set(arr, i, sizeof(test_data), &d);
+            expected++;
+        }
+    }
+
+    indexarray ia = IndexArray.from_farray(arr, sizeof(test_data));
+    Assert.isNotNull(ia, "from_farray should succeed");
+    Assert.areEqual(&(usize){(usize)expected}, &(usize){IndexArray.count(ia)}, LONG,
+                    "Count should match the non-empty source elements");
+
+    // packed in source order; export the live values back out
+    test_data *out = malloc(sizeof(test_data) * cap);
+    usize copied = IndexArray.export_values(ia, out, cap);
+    Assert.areEqual(&(usize){(usize)expected}, &copied, LONG, "Export should copy every live value");
+    for (usize i = 0, k = 0; i < cap; i++) {
+        if (i % 7 != 3) {
+            Assert.areEqual(&(int){(int)i + 1}, &out[k++].id, INT, "Export order mismatch at %zu", i);
+        }
+    }
+
+    // holes are skipped and max_count caps the copy
+    IndexArray.remove_at(ia, 0);
+    IndexArray.remove_at(ia, 100);
+    copied = IndexArray.export_values(ia, out, 99);
+    Assert.areEqual(&(usize){99}, &copied, LONG, "Export should stop at max_count");
+    Assert.areEqual(&(int){2}, &out[0].id, INT, "Removed slot should be skipped");
+
+    free(out);
+    IndexArray.dispose(ia);
+    FArray.dispose(arr);
+}
+
 // test from_buffer with raw buffer range
 static void test_indexarray_from_buffer(void) {
     // Allocate a buffer for 5 test_data structs
@@ -396,6 +494,257 @@ static void test_indexarray_iterator_full(void) {
 }
 
 //  register test cases
+static void test_indexarray_handles(void) {
+    indexarray ia = IndexArray.new(1, sizeof(test_data));
+    test_data first = {1, 100};
+    test_data second = {2, 200};
+    test_data out;
+
+    sc_handle h1 = IndexArray.add_handle(ia, &first);
+    Assert.isTrue(h1 != SC_HANDLE_NULL, "add_handle failed");
+    Assert.areEqual(&(int){OK}, &(int){IndexArray.get_handle(ia, h1, &out)}, INT,
+                    "Fresh handle should resolve");
+    Assert.areEqual(&(int){100}, &out.value, INT, "Handle resolved to wrong value");
+
+    // removing and reusing the slot must not let the old handle alias the new value
+    Assert.areEqual(&(int){OK}, &(int){IndexArray.remove_handle(ia, h1)}, INT, "Remove failed");
+    sc_handle h2 = IndexArray.add_handle(ia, &second);
+    Assert.areEqual(&(usize){SC_HANDLE_INDEX(h1)}, &(usize){SC_HANDLE_INDEX(h2)}, LONG,
+                    "Freed slot should be reused");
+    Assert.areEqual(&(int){ERR}, &(int){IndexArray.get_handle(ia, h1, &out)}, INT,
+                    "Stale handle should be rejected");
+    Assert.areEqual(&(int){ERR}, &(int){IndexArray.remove_handle(ia, h1)}, INT,
+                    "Stale handle remove should be rejected");
+
+    // handles survive growth and are invalidated by clear
+    sc_handle grown[6];
+    for (int i = 0; i < 6; i++) {
+        test_data v = {i + 10, i};
+        grown[i] = IndexArray.add_handle(ia, &v);
+    }
+    Assert.areEqual(&(int){OK}, &(int){IndexArray.get_handle(ia, h2, &out)}, INT,
+                    "Handle should survive growth");
+    Assert.areEqual(&(int){OK}, &(int){IndexArray.get_handle(ia, grown[5], &out)}, INT,
+                    "Handle issued after growth should resolve");
+    Assert.areEqual(&(int){15}, &out.id, INT, "Handle issued after growth resolved wrong value");
+    IndexArray.clear(ia);
+    Assert.areEqual(&(int){ERR}, &(int){IndexArray.get_handle(ia, h2, &out)}, INT,
+                    "Clear should invalidate handles");
+    // clear leaves slot generations alone; a slot reused after it still rejects older handles
+    sc_handle h3 = IndexArray.add_handle(ia, &first);
+    Assert.areEqual(&(usize){SC_HANDLE_INDEX(h2)}, &(usize){SC_HANDLE_INDEX(h3)}, LONG,
+                    "Cleared slot should be reused");
+    Assert.isTrue(h3 != h2 && h3 != h1, "Handle after clear must differ from earlier handles");
+    Assert.areEqual(&(int){ERR}, &(int){IndexArray.get_handle(ia, h2, &out)}, INT,
+                    "Pre-clear handle should stay invalid after slot reuse");
+    Assert.areEqual(&(int){OK}, &(int){IndexArray.get_handle(ia, h3, &out)}, INT,
+                    "Handle issued after clear should resolve");
+    IndexArray.remove_handle(ia, h3);
+    IndexArray.clear(ia);
+    sc_handle h4 = IndexArray.add_handle(ia, &second);
+    Assert.isTrue(h4 != h3 && h4 != h2, "Remove then clear must not recycle a handle");
+    Assert.areEqual(&(int){ERR}, &(int){IndexArray.get_handle(ia, SC_HANDLE_NULL, &out)}, INT,
+                    "Null handle should never resolve");
+
+    IndexArray.dispose(ia);
+}
+
+static void test_indexarray_compact(void) {
+    indexarray ia = IndexArray.new(6, sizeof(test_data));
+    for (int i = 0; i < 6; i++) {
+        test_data v = {i + 1, i * 10};
+        IndexArray.add(ia, &v);
+    }
+    IndexArray.remove_at(ia, 1);
+    IndexArray.remove_at(ia, 2);
+
+    farray remap = NULL;
+    int live = IndexArray.compact(ia, &remap);
+    Assert.areEqual(&(int){4}, &live, INT, "Compact should report 4 live slots");
+
+    int expected[6] = {0, -1, -1, 1, 2, 3};
+    for (int i = 0; i < 6; i++) {
+        int mapped;
+        FArray.get(remap, i, sizeof(int), &mapped);
+        Assert.areEqual(&expected[i], &mapped, INT, "Remap mismatch at %d", i);
+        if (mapped >= 0) {
+            test_data out;
+            IndexArray.get_at(ia, mapped, &out);
+            Assert.areEqual(&(int){i + 1}, &out.id, INT, "Value %d not moved to remapped slot", i);
+        }
+    }
+    FArray.dispose(remap);
+
+    Assert.isTrue(IndexArray.is_empty_slot(ia, 4), "Vacated tail slot should be empty");
+    Assert.areEqual(&(int){OK}, &(int){IndexArray.shrink_to_fit(ia)}, INT, "Shrink failed");
+    Assert.areEqual(&(usize){4}, &(usize){IndexArray.capacity(ia)}, LONG, "Capacity should be 4");
+
+    // compact without a remap table is allowed
+    Assert.areEqual(&(int){4}, &(int){IndexArray.compact(ia, NULL)}, INT, "Compact(NULL) failed");
+
+    IndexArray.dispose(ia);
+}
+
+static void test_indexarray_stats(void) {
+    indexarray ia = IndexArray.new(4, sizeof(test_data));
+    for (int i = 0; i < 100; i++) {
+        test_data v = {i + 1, i};
+        IndexArray.add(ia, &v);  // grows 4 -> 8 -> ... -> 128
+    }
+    Assert.areEqual(&(usize){100}, &(usize){IndexArray.count(ia)}, LONG, "Count should be 100");
+    Assert.areEqual(&(usize){28}, &(usize){IndexArray.largest_free_run(ia)}, LONG,
+                    "Unused tail after growth is one free run");
+
+    IndexArray.remove_at(ia, 3);
+    IndexArray.remove_at(ia, 3);  // second remove of an empty slot must not change the count
+    Assert.areEqual(&(usize){99}, &(usize){IndexArray.count(ia)}, LONG, "Count should be 99");
+    Assert.isTrue(IndexArray.fill_ratio(ia) == 99.0 / 128.0, "Fill ratio mismatch");
+    Assert.isTrue(IndexArray.fragmentation(ia) > 0.0, "A stray hole fragments free space");
+
+    IndexArray.clear(ia);
+    Assert.areEqual(&(usize){0}, &(usize){IndexArray.count(ia)}, LONG, "Clear resets count");
+    Assert.areEqual(&(usize){128}, &(usize){IndexArray.largest_free_run(ia)}, LONG,
+                    "Cleared indexarray is one free run");
+    IndexArray.dispose(ia);
+}
+
+static void test_indexarray_batch(void) {
+    indexarray ia = IndexArray.new(4, sizeof(test_data));
+    test_data first = {100, 0};
+    IndexArray.add(ia, &first);
+
+    // batch larger than capacity: reserved up front, then filled in one sweep
+    test_data values[20];
+    sc_handle handles[20];
+    for (int i = 0; i < 20; i++) {
+        values[i] = (test_data){i + 1, i * 10};
+    }
+    Assert.areEqual(&(int){20}, &(int){IndexArray.add_many(ia, values, 20, handles)}, INT,
+                    "add_many should add every value");
+    Assert.areEqual(&(usize){21}, &(usize){IndexArray.count(ia)}, LONG, "Count should be 21");
+    Assert.areEqual(&(usize){32}, &(usize){IndexArray.capacity(ia)}, LONG, "Should grow to 32");
+    for (int i = 0; i < 20; i++) {
+        test_data out = {0};
+        Assert.areEqual(&(int){OK}, &(int){IndexArray.get_handle(ia, handles[i], &out)}, INT,
+                        "Handle %d should resolve", i);
+        Assert.areEqual(&values[i].id, &out.id, INT, "Handle %d resolved to wrong value", i);
+    }
+
+    // remove every other value, plus one handle twice
+    sc_handle doomed[11];
+    for (int i = 0; i < 10; i++) {
+        doomed[i] = handles[i * 2];
+    }
+    doomed[10] = handles[0];
+    Assert.areEqual(&(int){10}, &(int){IndexArray.remove_many(ia, doomed, 11)}, INT,
+                    "Duplicate handle should be skipped");
+    Assert.areEqual(&(usize){11}, &(usize){IndexArray.count(ia)}, LONG, "Count should be 11");
+    test_data out;
+    Assert.areEqual(&(int){ERR}, &(int){IndexArray.get_handle(ia, handles[2], &out)}, INT,
+                    "Removed handle should be stale");
+
+    // the holes are refilled without growing
+    Assert.areEqual(&(int){10}, &(int){IndexArray.add_many(ia, values, 10, NULL)}, INT,
+                    "Refill should add every value");
+    Assert.areEqual(&(usize){32}, &(usize){IndexArray.capacity(ia)}, LONG, "Refill must not grow");
+    Assert.areEqual(&(usize){21}, &(usize){IndexArray.count(ia)}, LONG, "Count should be 21");
+
+    IndexArray.dispose(ia);
+}
+
+static void test_indexarray_free_summary(void) {
+    // spans several level-2 summary blocks (4096 slots each) plus a partial word
+    usize capacity = 3 * 4096 + 100;
+    indexarray ia = IndexArray.new(capacity, sizeof(test_data));
+    for (usize i = 0; i < capacity; i++) {
+        test_data item = {(int)i + 1, 0};
+        IndexArray.add(ia, &item);
+    }
+    Assert.areEqual(&capacity, &(usize){IndexArray.count(ia)}, LONG, "Should be full");
+
+    // the searches must skip thousands of full slots to reach the holes
+    IndexArray.remove_at(ia, 5);
+    IndexArray.remove_at(ia, 9000);
+    IndexArray.remove_at(ia, capacity - 1);
+    test_data item = {-1, 0};
+    Assert.areEqual(&(int){5}, &(int){IndexArray.add(ia, &item)}, INT, "First hole should be 5");
+    Assert.areEqual(&(int){9000}, &(int){IndexArray.add(ia, &item)}, INT, "Next hole should be 9000");
+    Assert.areEqual(&(int){(int)capacity - 1}, &(int){IndexArray.add(ia, &item)}, INT,
+                    "Last hole sits in the partial tail word");
+    Assert.areEqual(&(int){(int)capacity}, &(int){IndexArray.add(ia, &item)}, INT,
+                    "A full array should grow");
+
+    // compact rebuilds the summary: the next add lands right after the packed values
+    for (usize i = 0; i < 8192; i++) {
+        IndexArray.remove_at(ia, i);
+    }
+    int live = IndexArray.compact(ia, NULL);
+    Assert.areEqual(&live, &(int){IndexArray.add(ia, &item)}, INT, "Add should follow packed values");
+
+    IndexArray.clear(ia);
+    Assert.areEqual(&(int){0}, &(int){IndexArray.add(ia, &item)}, INT, "Clear should free slot 0");
+
+    IndexArray.dispose(ia);
+}
+
+// instance allocator that fails once allocs_left successful allocations have been made
+static int allocs_left = -1;  // -1 = never fail
+static object failing_alloc(usize size) {
+    if (allocs_left == 0) {
+        return NULL;
+    }
+    if (allocs_left > 0) {
+        allocs_left--;
+    }
+    return calloc(1, size ? size : 1);
+}
+static sc_alloc_use_t failing_use = {.alloc = failing_alloc, .release = free};
+
+static void test_indexarray_grow_alloc_failure(void) {
+    indexarray ia = IndexArray.new_with(&failing_use, 4, sizeof(test_data));
+    sc_handle handles[4];
+    for (int i = 0; i < 4; i++) {
+        test_data item = {i + 1, i * 10};
+        handles[i] = IndexArray.add_handle(ia, &item);  // also allocates the generation table
+    }
+
+    // fail the growth at every allocation it makes: bucket, occupancy, summary, generations
+    int grown = 0;
+    for (int budget = 0; budget < 16; budget++) {
+        allocs_left = budget;
+        test_data item = {100, 0};
+        int slot = IndexArray.add(ia, &item);
+        allocs_left = -1;
+        if (slot >= 0) {
+            Assert.areEqual(&(int){4}, &slot, INT, "Grown add should land in the first new slot");
+            grown = 1;
+            break;
+        }
+        Assert.areEqual(&(usize){4}, &(usize){IndexArray.capacity(ia)}, LONG,
+                        "Failed growth (budget %d) must leave capacity unchanged", budget);
+        Assert.areEqual(&(usize){4}, &(usize){IndexArray.count(ia)}, LONG, "Count changed by failure");
+        for (int i = 0; i < 4; i++) {
+            test_data out = {0};
+            Assert.areEqual(&(int){OK}, &(int){IndexArray.get_handle(ia, handles[i], &out)}, INT,
+                            "Handle %d lost after failed growth", i);
+            Assert.areEqual(&(int){i + 1}, &out.id, INT, "Value %d changed by failed growth", i);
+        }
+    }
+    Assert.isTrue(grown, "Growth should succeed once allocations do");
+
+    // the side tables cover the new capacity: fill it and keep using handles
+    for (int i = 5; i < 8; i++) {
+        test_data item = {i + 1, 0};
+        Assert.areEqual(&i, &(int){IndexArray.add(ia, &item)}, INT, "Add into grown slot %d", i);
+    }
+    test_data out = {0};
+    Assert.areEqual(&(int){OK}, &(int){IndexArray.get_handle(ia, handles[3], &out)}, INT,
+                    "Old handle invalid after growth");
+    Assert.isFalse(IndexArray.is_empty_slot(ia, 7), "Last grown slot should be occupied");
+
+    IndexArray.dispose(ia);
+}
+
 static void register_indexarray_tests(void) {
     testset("core_indexarray_set", set_config, set_teardown);
     DebugLogger.log("Test Source: %s", __FILE__);
@@ -408,9 +757,18 @@ static void register_indexarray_tests(void) {
     testcase("indexarray_is_empty_slot", test_indexarray_is_empty_slot);
     testcase("indexarray_capacity", test_indexarray_capacity);
     testcase("indexarray_clear", test_indexarray_clear);
+    testcase("indexarray_handles", test_indexarray_handles);
+    testcase("indexarray_compact", test_indexarray_compact);
+    testcase("indexarray_stats", test_indexarray_stats);
+    testcase("indexarray_batch", test_indexarray_batch);
+    testcase("indexarray_clear_reuse", test_indexarray_clear_reuse);
+    testcase("indexarray_zero_values", test_indexarray_zero_values);
+    testcase("indexarray_free_summary", test_indexarray_free_summary);
+    testcase("indexarray_grow_alloc_failure", test_indexarray_grow_alloc_failure);
     testcase("indexarray_slot_reuse", test_indexarray_slot_reuse);
     testcase("indexarray_growth", test_indexarray_growth);
     testcase("indexarray_from_farray", test_indexarray_from_farray);
+    testcase("indexarray_bulk_import_export", test_indexarray_bulk_import_export);
     testcase("indexarray_from_buffer", test_indexarray_from_buffer);
     testcase("indexarray_create_iterator", test_indexarray_create_iterator);
     testcase("indexarray_iterator_empty", test_indexarray_iterator_empty);
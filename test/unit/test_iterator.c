@@ -1,6 +1,7 @@
 /*
  * Test file for iterator utilities
  */
+#include <sigma.core/allocator.h>
 #include <sigma.test/sigtest.h>
 #include <string.h>
 #include "collections.h"
@@ -70,12 +71,33 @@ void test_iterator_basic(void) {
     Collections.dispose(coll);
 }
 
+// an owning view of a plain Allocator buffer frees it with the Allocator, not as an array bucket
+void test_owning_raw_view(void) {
+    int *data = Allocator.alloc(sizeof(int) * 4);
+    Assert.isNotNull(data, "Buffer allocation failed");
+    for (int i = 0; i < 4; i++) {
+        data[i] = i + 1;
+    }
+
+    collection coll = Collections.create_view(data, sizeof(int), 4, true);
+    Assert.isNotNull(coll, "Collection creation failed");
+    iterator it = Collections.create_iterator(coll);
+    int sum = 0;
+    while (Iterator.next(it)) {
+        sum += *(int *)Iterator.current(it);
+    }
+    Assert.areEqual(&(int){10}, &sum, INT, "Owning view sum mismatch");
+    Iterator.dispose(it);
+    Collections.dispose(coll);  // releases data
+}
+
 // Register tests
 static void register_iterator_tests(void) {
     testset("core_iterator_set", set_config, set_teardown);
     DebugLogger.log("Test Source: %s", __FILE__);
 
     testcase("Iterator basic", test_iterator_basic);
+    testcase("Owning raw view", test_owning_raw_view);
 }
 __attribute__((constructor)) static void enqueue_iterator_tests(void) {
     Tests.enqueue(register_iterator_tests);
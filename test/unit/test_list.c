@@ -262,6 +262,26 @@ static void test_list_clear(void) {
 
     List.dispose(lst);
 }
+static void test_list_clear_reuse(void) {
+    list lst;
+    load_person_list(&lst);
+    dispose_persons(lst);
+    List.clear(lst);
+
+    // slots left behind by clear are overwritten by the next append
+    Person *expP = malloc(sizeof(Person));
+    expP->id = 7;
+    List.append(lst, expP);
+    object retrieved = NULL;
+    int result = List.get(lst, 0, &retrieved);
+    Assert.areEqual(&(int){0}, &result, INT, "List get after clear ERRed");
+    Assert.areEqual(expP, retrieved, PTR, "List append after clear pointer mismatch");
+    result = List.get(lst, 1, &retrieved);
+    Assert.areEqual(&(int){-1}, &result, INT, "Cleared slot should be out of bounds");
+
+    free(expP);
+    List.dispose(lst);
+}
 
 //  advanced/bulk data manipulation tests
 static void test_list_growth(void) {
@@ -488,6 +508,7 @@ static void register_list_tests(void) {
     testcase("list_insert_value", test_list_insert_value);
     testcase("list_prepend_value", test_list_prepend_value);
     testcase("list_clear", test_list_clear);
+    testcase("list_clear_reuse", test_list_clear_reuse);
 
     testcase("list_growth", test_list_growth);
     testcase("list_add_all", test_list_add_all);
@@ -0,0 +1,157 @@
+/*
+ *  Test File: test_objectpool.c
+ *  Description: Test cases for ObjectPool collection
+ */
+
+#include <sigma.test/sigtest.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "collections.h"
+#include "objectpool.h"
+
+typedef struct test_node {
+    int id;
+    double weight;
+    char tag[20];
+} test_node;
+
+//  configure test set
+static void set_config(FILE **log_stream) { *log_stream = fopen("logs/test_objectpool.log", "w"); }
+static void set_teardown(void) {}
+
+static void test_objectpool_acquire_release(void) {
+    objectpool pool = ObjectPool.new(sizeof(test_node), 4);
+    Assert.isNotNull(pool, "ObjectPool creation failed");
+    Assert.areEqual(&(usize){0}, &(usize){ObjectPool.slab_count(pool)}, LONG, "No slab before first acquire");
+
+    test_node *nodes[4];
+    for (int i = 0; i < 4; i++) {
+        nodes[i] = ObjectPool.acquire(pool);
+        Assert.isNotNull(nodes[i], "Acquire %d failed", i);
+        Assert.isTrue(((uintptr_t)nodes[i] & 15) == 0, "Object %d not 16-byte aligned", i);
+        Assert.areEqual(&(int){0}, &nodes[i]->id, INT, "Object %d not zeroed", i);
+        nodes[i]->id = i + 1;
+    }
+    Assert.areEqual(&(usize){1}, &(usize){ObjectPool.slab_count(pool)}, LONG, "One slab should hold 4 objects");
+    Assert.areEqual(&(usize){4}, &(usize){ObjectPool.count(pool)}, LONG, "Count should be 4");
+
+    // release then acquire hands back the same block, zeroed
+    Assert.areEqual(&(int){OK}, &(int){ObjectPool.release(pool, nodes[2])}, INT, "Release failed");
+    Assert.areEqual(&(int){ERR}, &(int){ObjectPool.release(pool, nodes[2])}, INT, "Double release should fail");
+    test_node *again = ObjectPool.acquire(pool);
+    Assert.isTrue(again == nodes[2], "Vacant block should be reused");
+    Assert.areEqual(&(int){0}, &again->id, INT, "Reused object not zeroed");
+    Assert.areEqual(&(int){2}, &nodes[1]->id, INT, "Neighbouring object disturbed");
+
+    // a full slab triggers a second one
+    test_node *extra = ObjectPool.acquire(pool);
+    Assert.isNotNull(extra, "Acquire past the first slab failed");
+    Assert.areEqual(&(usize){2}, &(usize){ObjectPool.slab_count(pool)}, LONG, "Second slab expected");
+    Assert.areEqual(&(usize){8}, &(usize){ObjectPool.capacity(pool)}, LONG, "Capacity should be 8");
+
+    ObjectPool.dispose(pool);
+}
+
+static void test_objectpool_trim(void) {
+    objectpool pool = ObjectPool.new(sizeof(test_node), 2);
+    object objs[6];
+    for (int i = 0; i < 6; i++) {
+        objs[i] = ObjectPool.acquire(pool);
+    }
+    Assert.areEqual(&(usize){3}, &(usize){ObjectPool.slab_count(pool)}, LONG, "Three slabs expected");
+
+    // empty slabs are retained by default and released by trim
+    ObjectPool.release(pool, objs[0]);
+    ObjectPool.release(pool, objs[1]);
+    Assert.areEqual(&(usize){3}, &(usize){ObjectPool.slab_count(pool)}, LONG, "Empty slab should be retained");
+    Assert.areEqual(&(usize){1}, &(usize){ObjectPool.trim(pool)}, LONG, "Trim should release one slab");
+    Assert.areEqual(&(usize){2}, &(usize){ObjectPool.slab_count(pool)}, LONG, "Two slabs after trim");
+
+    // with release_empty, a slab goes back as soon as its last object does
+    ObjectPool.set_release_empty(pool, true);
+    ObjectPool.release(pool, objs[2]);
+    ObjectPool.release(pool, objs[3]);
+    Assert.areEqual(&(usize){1}, &(usize){ObjectPool.slab_count(pool)}, LONG, "Empty slab should be released");
+
+    // the last slab is kept even when it empties
+    ObjectPool.release(pool, objs[4]);
+    ObjectPool.release(pool, objs[5]);
+    Assert.areEqual(&(usize){1}, &(usize){ObjectPool.slab_count(pool)}, LONG, "Last slab should be kept");
+    Assert.areEqual(&(usize){0}, &(usize){ObjectPool.count(pool)}, LONG, "Pool should be empty");
+    Assert.isNotNull(ObjectPool.acquire(pool), "Acquire after release failed");
+
+    ObjectPool.dispose(pool);
+}
+
+static void test_objectpool_release_invalid(void) {
+    objectpool pool = ObjectPool.new(sizeof(test_node), 2);
+    objectpool other = ObjectPool.new(sizeof(test_node), 2);
+    object objs[4];
+    for (int i = 0; i < 4; i++) {
+        objs[i] = ObjectPool.acquire(pool);
+    }
+    object foreign = ObjectPool.acquire(other);
+
+    // objs[0..1] empty the first slab, which is freed; releasing again must not touch it
+    ObjectPool.set_release_empty(pool, true);
+    ObjectPool.release(pool, objs[0]);
+    ObjectPool.release(pool, objs[1]);
+    Assert.areEqual(&(usize){1}, &(usize){ObjectPool.slab_count(pool)}, LONG, "Empty slab should be released");
+    Assert.areEqual(&(int){ERR}, &(int){ObjectPool.release(pool, objs[1])}, INT,
+                    "Double release into a freed slab should fail");
+
+    // another pool's object and a pointer inside a block are rejected without side effects
+    Assert.areEqual(&(int){ERR}, &(int){ObjectPool.release(pool, foreign)}, INT, "Foreign release should fail");
+    Assert.areEqual(&(int){ERR}, &(int){ObjectPool.release(pool, (char *)objs[2] + 1)}, INT,
+                    "Interior pointer release should fail");
+    Assert.areEqual(&(usize){2}, &(usize){ObjectPool.count(pool)}, LONG, "Count should be unchanged");
+    Assert.areEqual(&(usize){1}, &(usize){ObjectPool.count(other)}, LONG, "Other pool should be unchanged");
+    Assert.areEqual(&(int){OK}, &(int){ObjectPool.release(other, foreign)}, INT, "Owner release failed");
+
+    ObjectPool.dispose(other);
+    ObjectPool.dispose(pool);
+}
+
+static void test_objectpool_iterator(void) {
+    objectpool pool = ObjectPool.new(sizeof(test_node), 3);
+    test_node *nodes[7];
+    for (int i = 0; i < 7; i++) {
+        nodes[i] = ObjectPool.acquire(pool);
+        nodes[i]->id = i;
+    }
+    ObjectPool.release(pool, nodes[1]);
+    ObjectPool.release(pool, nodes[4]);
+
+    // only live objects are visited, each exactly once
+    int seen = 0, visited = 0;
+    sparse_iterator it = ObjectPool.create_iterator(pool);
+    Assert.isNotNull(it, "Iterator creation failed");
+    while (SparseIterator.next(it)) {
+        test_node *node = NULL;
+        SparseIterator.current_value(it, (object *)&node);
+        Assert.isNotNull(node, "Iterator yielded NULL");
+        seen |= 1 << node->id;
+        visited++;
+    }
+    Assert.areEqual(&(int){5}, &visited, INT, "Should visit 5 live objects");
+    Assert.areEqual(&(int){0x6D}, &seen, INT, "Released objects should be skipped");
+
+    SparseIterator.dispose(it);
+    ObjectPool.dispose(pool);
+}
+
+//  register test cases
+static void register_objectpool_tests(void) {
+    testset("core_objectpool_set", set_config, set_teardown);
+    DebugLogger.log("Test Source: %s", __FILE__);
+
+    testcase("objectpool_acquire_release", test_objectpool_acquire_release);
+    testcase("objectpool_trim", test_objectpool_trim);
+    testcase("objectpool_release_invalid", test_objectpool_release_invalid);
+    testcase("objectpool_iterator", test_objectpool_iterator);
+}
+__attribute__((constructor)) static void enqueue_objectpool_tests(void) {
+    Tests.enqueue(register_objectpool_tests);
+}
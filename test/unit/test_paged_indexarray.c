@@ -0,0 +1,135 @@
+/*
+ *  Test File: test_paged_indexarray.c
+ *  Description: Test cases for PagedIndexArray collection
+ */
+
+#include <sigma.test/sigtest.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "collections.h"
+#include "paged_indexarray.h"
+
+typedef struct test_item {
+    int id;
+    int value;
+} test_item;
+
+//  configure test set
+static void set_config(FILE **log_stream) { *log_stream = fopen("logs/test_paged_indexarray.log", "w"); }
+static void set_teardown(void) {}
+
+static void test_paged_stable_addresses(void) {
+    // 64-byte pages hold 8 items each
+    paged_indexarray pa = PagedIndexArray.new(sizeof(test_item), 64);
+    Assert.isNotNull(pa, "PagedIndexArray creation failed");
+    Assert.areEqual(&(usize){8}, &(usize){PagedIndexArray.per_page(pa)}, LONG, "Should fit 8 slots per page");
+    Assert.areEqual(&(usize){0}, &(usize){PagedIndexArray.page_count(pa)}, LONG, "No page before first add");
+
+    test_item first = {0, 100};
+    int index = PagedIndexArray.add(pa, &first);
+    Assert.areEqual(&(int){0}, &index, INT, "First add should use slot 0");
+    test_item *pinned = PagedIndexArray.get_ptr(pa, 0);
+    Assert.isNotNull(pinned, "get_ptr failed");
+
+    // grow across many pages and several directory doublings
+    for (int i = 1; i < 200; i++) {
+        test_item item = {i, i * 10};
+        Assert.areEqual(&i, &(int){PagedIndexArray.add(pa, &item)}, INT, "Slots should fill in order");
+    }
+    Assert.isTrue(PagedIndexArray.get_ptr(pa, 0) == pinned, "Growth moved an element");
+    Assert.areEqual(&(int){100}, &pinned->value, INT, "Pinned element changed");
+    Assert.areEqual(&(usize){200}, &(usize){PagedIndexArray.count(pa)}, LONG, "Count should be 200");
+    Assert.areEqual(&(usize){25}, &(usize){PagedIndexArray.page_count(pa)}, LONG, "Should use 25 pages");
+
+    test_item out = {0};
+    Assert.areEqual(&(int){OK}, &(int){PagedIndexArray.get_at(pa, 123, &out)}, INT, "get_at failed");
+    Assert.areEqual(&(int){1230}, &out.value, INT, "Wrong value at slot 123");
+
+    // removed slot is reused before any new page
+    PagedIndexArray.remove_at(pa, 17);
+    Assert.isTrue(PagedIndexArray.get_ptr(pa, 17) == NULL, "Removed slot should be empty");
+    Assert.areEqual(&(int){17}, &(int){PagedIndexArray.add(pa, &first)}, INT, "Lowest free slot reused");
+
+    PagedIndexArray.dispose(pa);
+}
+
+static void test_paged_release_trim(void) {
+    paged_indexarray pa = PagedIndexArray.new(sizeof(test_item), 64);
+    for (int i = 0; i < 32; i++) {
+        test_item item = {i, i};
+        PagedIndexArray.add(pa, &item);
+    }
+    Assert.areEqual(&(usize){4}, &(usize){PagedIndexArray.page_count(pa)}, LONG, "Should use 4 pages");
+
+    // empty page 1 with retention: page stays until trim
+    for (usize i = 8; i < 16; i++) {
+        PagedIndexArray.remove_at(pa, i);
+    }
+    Assert.areEqual(&(usize){4}, &(usize){PagedIndexArray.page_count(pa)}, LONG, "Empty page is retained");
+    Assert.areEqual(&(usize){1}, &(usize){PagedIndexArray.trim(pa)}, LONG, "Trim should release one page");
+    Assert.areEqual(&(usize){3}, &(usize){PagedIndexArray.page_count(pa)}, LONG, "Three pages remain");
+    Assert.isTrue(PagedIndexArray.is_empty_slot(pa, 9), "Released range should read empty");
+
+    // release on empty: page 2 goes as soon as it drains
+    PagedIndexArray.set_release_empty(pa, true);
+    for (usize i = 16; i < 24; i++) {
+        PagedIndexArray.remove_at(pa, i);
+    }
+    Assert.areEqual(&(usize){2}, &(usize){PagedIndexArray.page_count(pa)}, LONG, "Drained page should be released");
+
+    // the released range is reallocated on demand; other pages are untouched
+    test_item *last = PagedIndexArray.get_ptr(pa, 31);
+    test_item item = {99, 99};
+    Assert.areEqual(&(int){8}, &(int){PagedIndexArray.add(pa, &item)}, INT, "Released range should be reused");
+    Assert.areEqual(&(usize){3}, &(usize){PagedIndexArray.page_count(pa)}, LONG, "Page reallocated");
+    Assert.isTrue(PagedIndexArray.get_ptr(pa, 31) == last, "Other pages must not move");
+    Assert.areEqual(&(usize){32}, &(usize){PagedIndexArray.capacity(pa)}, LONG, "Capacity spans the directory");
+
+    PagedIndexArray.dispose(pa);
+}
+
+static void test_paged_iterator(void) {
+    paged_indexarray pa = PagedIndexArray.new(sizeof(test_item), 64);
+    for (int i = 0; i < 20; i++) {
+        test_item item = {i, i};
+        PagedIndexArray.add(pa, &item);
+    }
+    for (usize i = 0; i < 20; i += 2) {
+        PagedIndexArray.remove_at(pa, i);
+    }
+
+    int visited = 0, sum = 0;
+    sparse_iterator it = PagedIndexArray.create_iterator(pa);
+    Assert.isNotNull(it, "Iterator creation failed");
+    while (SparseIterator.next(it)) {
+        test_item out;
+        SparseIterator.current_value(it, (object *)&out);
+        sum += out.id;
+        visited++;
+    }
+    Assert.areEqual(&(int){10}, &visited, INT, "Should visit 10 live items");
+    Assert.areEqual(&(int){100}, &sum, INT, "Should visit every odd id");
+    SparseIterator.dispose(it);
+
+    PagedIndexArray.clear(pa);
+    Assert.areEqual(&(usize){0}, &(usize){PagedIndexArray.count(pa)}, LONG, "Clear should empty it");
+    Assert.areEqual(&(usize){3}, &(usize){PagedIndexArray.page_count(pa)}, LONG, "Clear keeps pages");
+    Assert.areEqual(&(usize){3}, &(usize){PagedIndexArray.trim(pa)}, LONG, "Trim releases cleared pages");
+
+    PagedIndexArray.dispose(pa);
+}
+
+//  register test cases
+static void register_paged_indexarray_tests(void) {
+    testset("core_paged_indexarray_set", set_config, set_teardown);
+    DebugLogger.log("Test Source: %s", __FILE__);
+
+    testcase("paged_stable_addresses", test_paged_stable_addresses);
+    testcase("paged_release_trim", test_paged_release_trim);
+    testcase("paged_iterator", test_paged_iterator);
+}
+__attribute__((constructor)) static void enqueue_paged_indexarray_tests(void) {
+    Tests.enqueue(register_paged_indexarray_tests);
+}
@@ -13,6 +13,7 @@
  */
 
 #include <sigma.test/sigtest.h>
+#include <stdint.h>
 #include <stdio.h>
 #include <string.h>
 #include "collections.h"
@@ -204,6 +205,51 @@ static void test_array_to_collection(void) {
     PArray.dispose(arr);
 }
 
+static void test_array_resize(void) {
+    parray arr = PArray.new(4);
+    for (usize i = 0; i < 4; i++) {
+        PArray.set(arr, i, (addr)(1000 + i));
+    }
+    Assert.areEqual(&(int){0}, &(int){PArray.resize(arr, 64)}, INT, "resize should succeed");
+    Assert.areEqual(&(int){64}, &(int){PArray.capacity(arr)}, INT, "Capacity mismatch after resize");
+    addr value = 0;
+    PArray.get(arr, 3, &value);
+    Assert.isTrue(value == (addr)1003, "Value lost in resize");
+    PArray.get(arr, 40, &value);
+    Assert.isTrue(value == ADDR_EMPTY, "New tail should be empty");
+
+    Assert.areEqual(&(int){-1}, &(int){PArray.resize(arr, (usize)INT32_MAX + 1)}, INT,
+                    "Capacity above INT_MAX should be rejected");
+    // reserve never shrinks
+    Assert.areEqual(&(int){0}, &(int){PArray.reserve(arr, 8)}, INT, "reserve should succeed");
+    Assert.areEqual(&(int){64}, &(int){PArray.capacity(arr)}, INT, "reserve should not shrink");
+    PArray.resize(arr, 2);
+    Assert.areEqual(&(int){2}, &(int){PArray.capacity(arr)}, INT, "Capacity mismatch after shrink");
+    PArray.get(arr, 1, &value);
+    Assert.isTrue(value == (addr)1001, "Value lost in shrink");
+    PArray.dispose(arr);
+}
+
+static void test_array_index_of(void) {
+    parray arr = PArray.new(40);
+    for (usize i = 0; i < 30; i++) {
+        PArray.set(arr, i, (addr)(0x1000 + i));
+    }
+    Assert.areEqual(&(int){17}, &(int){PArray.index_of(arr, (addr)0x1011)}, INT, "index_of mismatch");
+    Assert.areEqual(&(int){-1}, &(int){PArray.index_of(arr, (addr)0x9999)}, INT,
+                    "Missing address should return -1");
+    Assert.areEqual(&(int){30}, &(int){PArray.index_of(arr, ADDR_EMPTY)}, INT,
+                    "ADDR_EMPTY should find the first empty slot");
+
+    addr wanted[] = {(addr)0x1003, (addr)0x101c};
+    Assert.areEqual(&(int){3}, &(int){PArray.find_any(arr, wanted, 2, 0)}, INT, "find_any mismatch");
+    Assert.areEqual(&(int){28}, &(int){PArray.find_any(arr, wanted, 2, 4)}, INT,
+                    "find_any from 4 mismatch");
+    Assert.areEqual(&(int){-1}, &(int){PArray.find_any(arr, wanted, 2, 40)}, INT,
+                    "from past capacity should return -1");
+    PArray.dispose(arr);
+}
+
 //  negative test cases
 static void test_array_set_out_of_bounds(void) {
     parray arr = PArray.new(5);
@@ -239,6 +285,8 @@ static void register_parray_tests(void) {
     testcase("array_set_value", test_array_set_value);
     testcase("array_get_value", test_array_get_value);
     testcase("array_remove_at", test_array_remove_at);
+    testcase("array_resize", test_array_resize);
+    testcase("array_index_of", test_array_index_of);
 
     testcase("array_as_collection", test_array_as_collection);
     testcase("array_to_collection", test_array_to_collection);
@@ -250,4 +298,3 @@ static void register_parray_tests(void) {
 __attribute__((constructor)) static void enqueue_parray_tests(void) {
     Tests.enqueue(register_parray_tests);
 }
-}
\ No newline at end of file
@@ -10,6 +10,7 @@
 #include "collections.h"
 #include "farray.h"
 #include "parray.h"
+#include "sc_fast.h"
 #include "slotarray.h"
 
 //  configure test set
@@ -101,6 +102,8 @@ static void test_slotarray_remove_at(void) {
 // test that slotarray does not grow beyond initial capacity
 static void test_slotarray_no_growth(void) {
     slotarray sa = SlotArray.new(3);  // Small initial capacity
+    Assert.areEqual(&(int){OK}, &(int){SlotArray.set_max_capacity(sa, 3)}, INT,
+                    "Capping growth at current capacity should succeed");
 
     // Add items up to capacity
     int *p1 = malloc(sizeof(int));
@@ -360,12 +363,10 @@ static void test_slotarray_from_value_array(void) {
         Assert.areEqual(&(int){values[i]}, (int *)retrieved, INT, "SlotArray value mismatch");
     }
 
-    // free the allocated objects
-    for (int i = 0; i < 5; i++) {
-        if (SlotArray.get_at(sa, i, &retrieved) == OK) {
-            free(retrieved);
-        }
-    }
+    // copies are independent of the source array and released by dispose
+    FArray.set(arr, 0, element_size, &(int){99});
+    SlotArray.get_at(sa, 0, &retrieved);
+    Assert.areEqual(&(int){10}, (int *)retrieved, INT, "SlotArray value should be a copy");
 
     SlotArray.dispose(sa);
     FArray.dispose(arr);
@@ -503,6 +504,251 @@ static void test_slotarray_iterator_full(void) {
     SlotArray.dispose(sa);
 }
 
+static void test_slotarray_free_slot_reuse(void) {
+    slotarray sa = SlotArray.new(8);
+    SlotArray.set_max_capacity(sa, 8);
+    int values[8];
+
+    for (int i = 0; i < 8; i++) {
+        int handle = SlotArray.add(sa, &values[i]);
+        Assert.areEqual(&i, &handle, INT, "Slots should fill in ascending order");
+    }
+    int full = SlotArray.add(sa, &values[0]);
+    Assert.areEqual(&(int){ERR}, &full, INT, "Add to full slotarray should fail");
+
+    // freed slots come back most-recently-freed first
+    SlotArray.remove_at(sa, 2);
+    SlotArray.remove_at(sa, 6);
+    SlotArray.remove_at(sa, 6);  // double remove must not duplicate the free entry
+    int first = SlotArray.add(sa, &values[6]);
+    int second = SlotArray.add(sa, &values[2]);
+    int third = SlotArray.add(sa, &values[0]);
+    Assert.areEqual(&(int){6}, &first, INT, "Last freed slot should be reused first");
+    Assert.areEqual(&(int){2}, &second, INT, "Earlier freed slot should be reused next");
+    Assert.areEqual(&(int){ERR}, &third, INT, "Stale free entry must not be handed out");
+
+    int bad = SlotArray.remove_at(sa, 8);
+    Assert.areEqual(&(int){ERR}, &bad, INT, "Out of bounds remove should fail");
+    int null_add = SlotArray.add(sa, NULL);
+    Assert.areEqual(&(int){ERR}, &null_add, INT, "NULL cannot be stored in a slot");
+
+    SlotArray.clear(sa);
+    int after_clear = SlotArray.add(sa, &values[0]);
+    Assert.areEqual(&(int){0}, &after_clear, INT, "Clear should restore every slot");
+
+    SlotArray.dispose(sa);
+}
+
+static void test_slotarray_growth(void) {
+    slotarray sa = SlotArray.new(2);
+    int values[20];
+
+    for (int i = 0; i < 20; i++) {
+        int handle = SlotArray.add(sa, &values[i]);
+        Assert.areEqual(&i, &handle, INT, "Growth should hand out the next index");
+    }
+    usize capacity = SlotArray.capacity(sa);
+    Assert.isTrue(capacity >= 20, "Capacity should have grown to hold 20 items");
+
+    // existing handles survive reallocation
+    for (int i = 0; i < 20; i++) {
+        object retrieved;
+        SlotArray.get_at(sa, i, &retrieved);
+        Assert.areEqual(&values[i], retrieved, PTR, "Handle %d lost its value on growth", i);
+    }
+
+    // a cap below the current capacity is rejected; at capacity growth stops
+    Assert.areEqual(&(int){ERR}, &(int){SlotArray.set_max_capacity(sa, 4)}, INT,
+                    "Max below capacity should fail");
+    Assert.areEqual(&(int){OK}, &(int){SlotArray.set_max_capacity(sa, capacity)}, INT,
+                    "Max at capacity should succeed");
+    for (usize i = 20; i < capacity; i++) {
+        SlotArray.add(sa, &values[0]);
+    }
+    int full = SlotArray.add(sa, &values[0]);
+    Assert.areEqual(&(int){ERR}, &full, INT, "Add beyond max capacity should fail");
+    SlotArray.dispose(sa);
+
+    // views never grow the caller's parray
+    parray arr = PArray.new(1);
+    slotarray view = PArray.as_slotarray(arr);
+    Assert.areEqual(&(int){0}, &(int){SlotArray.add(view, &values[0])}, INT, "View add failed");
+    Assert.areEqual(&(int){ERR}, &(int){SlotArray.add(view, &values[1])}, INT,
+                    "Full view should not grow");
+    Assert.areEqual(&(int){ERR}, &(int){SlotArray.set_max_capacity(view, 0)}, INT,
+                    "Views cannot be made growable");
+    SlotArray.dispose(view);
+    PArray.dispose(arr);
+}
+
+static void test_slotarray_view_rescan(void) {
+    int values[3] = {1, 2, 3};
+    parray arr = PArray.new(2);
+    slotarray view = PArray.as_slotarray(arr);
+    SlotArray.add(view, &values[0]);
+    SlotArray.add(view, &values[1]);
+    Assert.areEqual(&(int){ERR}, &(int){SlotArray.add(view, &values[2])}, INT,
+                    "Full view add should fail");
+
+    // unchecked stores do not mark the parray changed, so a full view does not rescan for them
+    parray_store(arr, 0, ADDR_EMPTY);
+    Assert.areEqual(&(int){ERR}, &(int){SlotArray.add(view, &values[2])}, INT,
+                    "Unchanged parray should not be rescanned");
+
+    // PArray.remove does, and the rescan finds every free slot
+    PArray.remove(arr, 1);
+    Assert.areEqual(&(int){0}, &(int){SlotArray.add(view, &values[2])}, INT,
+                    "Rescan should hand out the lowest free slot");
+    Assert.areEqual(&(int){1}, &(int){SlotArray.add(view, &values[0])}, INT,
+                    "Rescan should find the removed slot");
+    Assert.areEqual(&(usize){2}, &(usize){SlotArray.count(view)}, LONG, "View count mismatch");
+
+    SlotArray.dispose(view);
+    PArray.dispose(arr);
+}
+
+static void test_slotarray_handles(void) {
+    slotarray sa = SlotArray.new(4);
+    int a = 1, b = 2;
+    object out = NULL;
+
+    sc_handle ha = SlotArray.add_handle(sa, &a);
+    Assert.isTrue(ha != SC_HANDLE_NULL, "add_handle failed");
+    Assert.areEqual(&(int){OK}, &(int){SlotArray.get_handle(sa, ha, &out)}, INT,
+                    "Fresh handle should resolve");
+    Assert.areEqual(&a, out, PTR, "Handle resolved to wrong value");
+
+    // plain remove_at also retires handles, so the reused slot is not aliased
+    SlotArray.remove_at(sa, SC_HANDLE_INDEX(ha));
+    sc_handle hb = SlotArray.add_handle(sa, &b);
+    Assert.areEqual(&(usize){SC_HANDLE_INDEX(ha)}, &(usize){SC_HANDLE_INDEX(hb)}, LONG,
+                    "Freed slot should be reused");
+    Assert.areEqual(&(int){ERR}, &(int){SlotArray.get_handle(sa, ha, &out)}, INT,
+                    "Stale handle should be rejected");
+    Assert.areEqual(&(int){OK}, &(int){SlotArray.remove_handle(sa, hb)}, INT,
+                    "Live handle remove should succeed");
+    Assert.areEqual(&(int){ERR}, &(int){SlotArray.remove_handle(sa, hb)}, INT,
+                    "Double remove should be rejected");
+
+    SlotArray.dispose(sa);
+}
+
+static void test_slotarray_compact(void) {
+    slotarray sa = SlotArray.new(8);
+    int values[8];
+    for (int i = 0; i < 8; i++) {
+        SlotArray.add(sa, &values[i]);
+    }
+    SlotArray.remove_at(sa, 0);
+    SlotArray.remove_at(sa, 3);
+    SlotArray.remove_at(sa, 7);
+
+    farray remap = NULL;
+    int live = SlotArray.compact(sa, &remap);
+    Assert.areEqual(&(int){5}, &live, INT, "Compact should report 5 live slots");
+    Assert.isNotNull(remap, "Remap table should be returned");
+
+    // old -> new: {-1, 0, 1, -1, 2, 3, 4, -1}
+    int expected[8] = {-1, 0, 1, -1, 2, 3, 4, -1};
+    for (int i = 0; i < 8; i++) {
+        int mapped;
+        FArray.get(remap, i, sizeof(int), &mapped);
+        Assert.areEqual(&expected[i], &mapped, INT, "Remap mismatch at %d", i);
+        if (mapped >= 0) {
+            object retrieved;
+            SlotArray.get_at(sa, mapped, &retrieved);
+            Assert.areEqual(&values[i], retrieved, PTR, "Value %d not moved to remapped slot", i);
+        }
+    }
+    FArray.dispose(remap);
+
+    // the tail is empty after compaction and can be released
+    Assert.areEqual(&(int){OK}, &(int){SlotArray.shrink_to_fit(sa)}, INT, "Shrink failed");
+    Assert.areEqual(&(usize){5}, &(usize){SlotArray.capacity(sa)}, LONG, "Capacity should be 5");
+    int handle = SlotArray.add(sa, &values[0]);
+    Assert.areEqual(&(int){5}, &handle, INT, "Add after shrink should grow again");
+
+    SlotArray.dispose(sa);
+}
+
+static void test_slotarray_batch(void) {
+    slotarray sa = SlotArray.new(4);
+    int values[20];
+    object ptrs[20];
+    sc_handle handles[20];
+    for (int i = 0; i < 20; i++) {
+        values[i] = i;
+        ptrs[i] = &values[i];
+    }
+
+    // a NULL anywhere rejects the whole batch
+    ptrs[5] = NULL;
+    Assert.areEqual(&(int){ERR}, &(int){SlotArray.add_many(sa, ptrs, 20, handles)}, INT,
+                    "NULL value should reject the batch");
+    Assert.areEqual(&(usize){0}, &(usize){SlotArray.count(sa)}, LONG, "Nothing should be added");
+    ptrs[5] = &values[5];
+
+    Assert.areEqual(&(int){20}, &(int){SlotArray.add_many(sa, ptrs, 20, handles)}, INT,
+                    "add_many should add every value");
+    Assert.areEqual(&(usize){20}, &(usize){SlotArray.count(sa)}, LONG, "Count should be 20");
+    for (int i = 0; i < 20; i++) {
+        object out = NULL;
+        SlotArray.get_handle(sa, handles[i], &out);
+        Assert.areEqual(&values[i], out, PTR, "Handle %d resolved to wrong value", i);
+        Assert.areEqual(&(usize){i}, &(usize){SC_HANDLE_INDEX(handles[i])}, LONG,
+                        "Slots should be claimed in ascending order");
+    }
+
+    Assert.areEqual(&(int){20}, &(int){SlotArray.remove_many(sa, handles, 20)}, INT,
+                    "remove_many should remove every value");
+    Assert.areEqual(&(int){0}, &(int){SlotArray.remove_many(sa, handles, 20)}, INT,
+                    "Stale handles should be skipped");
+    Assert.areEqual(&(usize){0}, &(usize){SlotArray.count(sa)}, LONG, "Count should be 0");
+
+    // a capped slotarray adds as many as fit
+    slotarray capped = SlotArray.new(4);
+    SlotArray.set_max_capacity(capped, 6);
+    Assert.areEqual(&(int){6}, &(int){SlotArray.add_many(capped, ptrs, 20, NULL)}, INT,
+                    "Capped batch should stop at max_capacity");
+
+    SlotArray.dispose(capped);
+    SlotArray.dispose(sa);
+}
+
+static void test_slotarray_stats(void) {
+    slotarray sa = SlotArray.new(200);
+    SlotArray.set_max_capacity(sa, 200);
+    static int values[200];
+    for (int i = 0; i < 200; i++) {
+        SlotArray.add(sa, &values[i]);
+    }
+    Assert.areEqual(&(usize){200}, &(usize){SlotArray.count(sa)}, LONG, "Count should be 200");
+    Assert.areEqual(&(usize){0}, &(usize){SlotArray.largest_free_run(sa)}, LONG,
+                    "Full slotarray has no free run");
+
+    // a 70-slot hole spanning a 64-bit word boundary, plus two isolated holes
+    for (usize i = 50; i < 120; i++) {
+        SlotArray.remove_at(sa, i);
+    }
+    SlotArray.remove_at(sa, 10);
+    SlotArray.remove_at(sa, 199);
+
+    Assert.areEqual(&(usize){128}, &(usize){SlotArray.count(sa)}, LONG, "Count should be 128");
+    Assert.isTrue(SlotArray.fill_ratio(sa) == 128.0 / 200.0, "Fill ratio should be 0.64");
+    Assert.areEqual(&(usize){70}, &(usize){SlotArray.largest_free_run(sa)}, LONG,
+                    "Largest free run should span the word boundary");
+    double fragmentation = SlotArray.fragmentation(sa);
+    Assert.isTrue(fragmentation > 0.027 && fragmentation < 0.028, "Fragmentation should be 2/72");
+
+    SlotArray.compact(sa, NULL);
+    Assert.areEqual(&(usize){128}, &(usize){SlotArray.count(sa)}, LONG, "Compact keeps count");
+    Assert.isTrue(SlotArray.fragmentation(sa) == 0.0, "Compacted free space is contiguous");
+
+    SlotArray.clear(sa);
+    Assert.areEqual(&(usize){0}, &(usize){SlotArray.count(sa)}, LONG, "Clear resets count");
+    SlotArray.dispose(sa);
+}
+
 //  register test cases
 static void register_slotarray_tests(void) {
     testset("core_slotarray_set", set_config, set_teardown);
@@ -522,6 +768,13 @@ static void register_slotarray_tests(void) {
     testcase("slotarray_get_capacity", test_slotarray_capacity);
     testcase("slotarray_clear", test_slotarray_clear);
     testcase("slotarray_stress", test_slotarray_stress);
+    testcase("slotarray_free_slot_reuse", test_slotarray_free_slot_reuse);
+    testcase("slotarray_growth", test_slotarray_growth);
+    testcase("slotarray_view_rescan", test_slotarray_view_rescan);
+    testcase("slotarray_handles", test_slotarray_handles);
+    testcase("slotarray_compact", test_slotarray_compact);
+    testcase("slotarray_stats", test_slotarray_stats);
+    testcase("slotarray_batch", test_slotarray_batch);
     testcase("slotarray_from_pointer_array", test_slotarray_from_pointer_array);
     testcase("slotarray_from_value_array", test_slotarray_from_value_array);
 
@@ -535,4 +788,3 @@ static void register_slotarray_tests(void) {
 __attribute__((constructor)) static void enqueue_slotarray_tests(void) {
     Tests.enqueue(register_slotarray_tests);
 }
-}
\ No newline at end of file
@@ -0,0 +1,125 @@
+/*
+ *  Test File: test_slotmap.c
+ *  Description: Test cases for SlotMap collection
+ */
+
+#include <sigma.test/sigtest.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "collections.h"
+#include "slotmap.h"
+
+typedef struct test_entity {
+    int id;
+    float x, y;
+} test_entity;
+
+//  configure test set
+static void set_config(FILE **log_stream) { *log_stream = fopen("logs/test_slotmap.log", "w"); }
+static void set_teardown(void) {}
+
+static void test_slotmap_add_get(void) {
+    slotmap sm = SlotMap.new(4, sizeof(test_entity));
+    Assert.isNotNull(sm, "SlotMap creation failed");
+
+    test_entity e = {7, 1.0f, 2.0f};
+    sc_handle h = SlotMap.add(sm, &e);
+    Assert.isTrue(h != SC_HANDLE_NULL, "Add failed");
+
+    test_entity out = {0};
+    Assert.areEqual(&(int){OK}, &(int){SlotMap.get(sm, h, &out)}, INT, "Get failed");
+    Assert.areEqual(&(int){7}, &out.id, INT, "Wrong value");
+    test_entity *ptr = SlotMap.get_ptr(sm, h);
+    Assert.isNotNull(ptr, "get_ptr failed");
+    Assert.areEqual(&(int){7}, &ptr->id, INT, "get_ptr points at wrong value");
+    Assert.areEqual(&(usize){1}, &(usize){SlotMap.count(sm)}, LONG, "Count should be 1");
+
+    SlotMap.dispose(sm);
+}
+
+static void test_slotmap_swap_remove(void) {
+    slotmap sm = SlotMap.new(2, sizeof(test_entity));
+    sc_handle handles[10];
+
+    // grows past the initial capacity
+    for (int i = 0; i < 10; i++) {
+        test_entity e = {i, 0, 0};
+        handles[i] = SlotMap.add(sm, &e);
+    }
+    Assert.areEqual(&(usize){10}, &(usize){SlotMap.count(sm)}, LONG, "Count should be 10");
+
+    // removing from the middle moves the last value into the hole
+    Assert.areEqual(&(int){OK}, &(int){SlotMap.remove(sm, handles[3])}, INT, "Remove failed");
+    test_entity *dense = SlotMap.values(sm);
+    Assert.areEqual(&(int){9}, &dense[3].id, INT, "Last value should fill the hole");
+    Assert.areEqual(&(usize){9}, &(usize){SlotMap.count(sm)}, LONG, "Count should be 9");
+    Assert.isTrue(SlotMap.handle_at(sm, 3) == handles[9], "Reverse table not updated");
+
+    // every surviving handle still resolves to its own value
+    for (int i = 0; i < 10; i++) {
+        test_entity out;
+        int result = SlotMap.get(sm, handles[i], &out);
+        if (i == 3) {
+            Assert.areEqual(&(int){ERR}, &result, INT, "Removed handle should be stale");
+        } else {
+            Assert.areEqual(&i, &out.id, INT, "Handle %d resolved to wrong value", i);
+        }
+    }
+
+    // the vacated index is reused under a new generation
+    test_entity e = {42, 0, 0};
+    sc_handle reused = SlotMap.add(sm, &e);
+    Assert.areEqual(&(usize){SC_HANDLE_INDEX(handles[3])}, &(usize){SC_HANDLE_INDEX(reused)},
+                    LONG, "Vacant index should be reused");
+    Assert.isFalse(SlotMap.contains(sm, handles[3]), "Old handle must not alias the new value");
+    Assert.isTrue(SlotMap.contains(sm, reused), "New handle should be live");
+
+    SlotMap.clear(sm);
+    Assert.areEqual(&(usize){0}, &(usize){SlotMap.count(sm)}, LONG, "Clear should empty the map");
+    Assert.isFalse(SlotMap.contains(sm, reused), "Clear should invalidate handles");
+
+    SlotMap.dispose(sm);
+}
+
+static void test_slotmap_iterator(void) {
+    slotmap sm = SlotMap.new(8, sizeof(test_entity));
+    sc_handle handles[8];
+    for (int i = 0; i < 8; i++) {
+        test_entity e = {i, 0, 0};
+        handles[i] = SlotMap.add(sm, &e);
+    }
+    for (int i = 0; i < 8; i += 2) {
+        SlotMap.remove(sm, handles[i]);
+    }
+
+    // only live values are visited, each exactly once
+    int seen = 0, visited = 0;
+    sparse_iterator it = SlotMap.create_iterator(sm);
+    Assert.isNotNull(it, "Iterator creation failed");
+    while (SparseIterator.next(it)) {
+        test_entity out;
+        SparseIterator.current_value(it, (object *)&out);
+        Assert.isTrue(out.id % 2 == 1, "Removed value visited");
+        seen |= 1 << out.id;
+        visited++;
+    }
+    Assert.areEqual(&(int){4}, &visited, INT, "Should visit 4 live values");
+    Assert.areEqual(&(int){0xAA}, &seen, INT, "Should visit every odd id");
+
+    SparseIterator.dispose(it);
+    SlotMap.dispose(sm);
+}
+
+//  register test cases
+static void register_slotmap_tests(void) {
+    testset("core_slotmap_set", set_config, set_teardown);
+    DebugLogger.log("Test Source: %s", __FILE__);
+
+    testcase("slotmap_add_get", test_slotmap_add_get);
+    testcase("slotmap_swap_remove", test_slotmap_swap_remove);
+    testcase("slotmap_iterator", test_slotmap_iterator);
+}
+__attribute__((constructor)) static void enqueue_slotmap_tests(void) {
+    Tests.enqueue(register_slotmap_tests);
+}
@@ -0,0 +1,175 @@
+/*
+ *  Test File: test_soa_indexarray.c
+ *  Description: Test cases for SoaIndexArray collection
+ */
+
+#include <sigma.test/sigtest.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "collections.h"
+#include "soa_indexarray.h"
+
+// 64-byte record; kernels typically touch only position and mass
+typedef struct test_body {
+    float x, y, z;
+    float mass;
+    int id;
+    char name[44];
+} test_body;
+
+static const sc_soa_field body_fields[] = {
+    {offsetof(test_body, x), sizeof(float) * 3},
+    {offsetof(test_body, mass), sizeof(float)},
+    {offsetof(test_body, id), sizeof(int)},
+    {offsetof(test_body, name), sizeof(char) * 44},
+};
+
+//  configure test set
+static void set_config(FILE **log_stream) { *log_stream = fopen("logs/test_soa_indexarray.log", "w"); }
+static void set_teardown(void) {}
+
+static void test_soa_gather_scatter(void) {
+    soa_indexarray sa = SoaIndexArray.new(4, body_fields, 4, sizeof(test_body));
+    Assert.isNotNull(sa, "SoaIndexArray creation failed");
+
+    test_body body = {1.0f, 2.0f, 3.0f, 10.0f, 7, "seven"};
+    int index = SoaIndexArray.add(sa, &body);
+    Assert.areEqual(&(int){0}, &index, INT, "First add should use slot 0");
+
+    test_body out;
+    memset(&out, 0, sizeof(out));
+    Assert.areEqual(&(int){OK}, &(int){SoaIndexArray.get_at(sa, 0, &out)}, INT, "Gather failed");
+    Assert.isTrue(memcmp(&body, &out, sizeof(body)) == 0, "Gathered record differs");
+
+    // set_at scatters over a live slot; field_at points into the column
+    body.mass = 20.0f;
+    Assert.areEqual(&(int){OK}, &(int){SoaIndexArray.set_at(sa, 0, &body)}, INT, "Scatter failed");
+    float *mass = SoaIndexArray.field_at(sa, 0, 1);
+    Assert.isNotNull(mass, "field_at failed");
+    Assert.isTrue(*mass == 20.0f, "Scatter did not reach the mass column");
+    Assert.areEqual(&(int){ERR}, &(int){SoaIndexArray.set_at(sa, 1, &body)}, INT,
+                    "set_at on an empty slot should fail");
+
+    // invalid field lists are rejected
+    sc_soa_field bad = {60, 8};
+    Assert.isTrue(SoaIndexArray.new(4, &bad, 1, sizeof(test_body)) == NULL,
+                  "Field past the record should be rejected");
+
+    SoaIndexArray.dispose(sa);
+}
+
+static void test_soa_columns(void) {
+    soa_indexarray sa = SoaIndexArray.new(2, body_fields, 4, sizeof(test_body));
+    for (int i = 0; i < 50; i++) {
+        test_body body = {(float)i, 0, 0, (float)i * 2.0f, i, ""};
+        SoaIndexArray.add(sa, &body);  // grows 2 -> 4 -> ... -> 64
+    }
+    SoaIndexArray.remove_at(sa, 10);
+    Assert.areEqual(&(usize){49}, &(usize){SoaIndexArray.count(sa)}, LONG, "Count should be 49");
+    Assert.areEqual(&(usize){64}, &(usize){SoaIndexArray.capacity(sa)}, LONG, "Capacity should be 64");
+
+    // each column is aligned and contiguous across slots
+    for (usize k = 0; k < SoaIndexArray.field_count(sa); k++) {
+        Assert.isTrue(((uintptr_t)SoaIndexArray.column(sa, k) % SOA_COLUMN_ALIGN) == 0,
+                      "Column %zu not aligned", k);
+    }
+
+    // single-column kernel masked by the occupancy bitmap
+    const float *mass = SoaIndexArray.column(sa, 1);
+    const uint64_t *live = SoaIndexArray.occupancy(sa);
+    float total = 0;
+    for (usize i = 0; i < SoaIndexArray.capacity(sa); i++) {
+        if ((live[i / 64] >> (i % 64)) & 1) {
+            total += mass[i];
+        }
+    }
+    // sum of 2i for i in [0, 50) minus the removed slot 10
+    Assert.isTrue(total == 2450.0f - 20.0f, "Column sum mismatch");
+
+    // removed slots read as empty; growth preserved every field of the rest
+    test_body out;
+    Assert.areEqual(&(int){ERR}, &(int){SoaIndexArray.get_at(sa, 10, &out)}, INT,
+                    "Removed slot should not be readable");
+    SoaIndexArray.get_at(sa, 49, &out);
+    Assert.areEqual(&(int){49}, &out.id, INT, "Growth lost the id column");
+    Assert.isTrue(out.x == 49.0f, "Growth lost the position column");
+
+    SoaIndexArray.dispose(sa);
+}
+
+static void test_soa_hot_cold_split(void) {
+    // 16-byte hot header (position + mass), 48-byte cold tail
+    usize hot_size = offsetof(test_body, id);
+    soa_indexarray sa = SoaIndexArray.new_split(4, sizeof(test_body), hot_size);
+    Assert.isNotNull(sa, "Split creation failed");
+    Assert.areEqual(&(usize){2}, &(usize){SoaIndexArray.field_count(sa)}, LONG, "Split has two parts");
+    Assert.isTrue(SoaIndexArray.new_split(4, sizeof(test_body), sizeof(test_body)) == NULL,
+                  "Hot part must leave a cold remainder");
+
+    for (int i = 0; i < 10; i++) {
+        test_body body = {(float)i, 0, 0, 1.0f, i, "cold"};
+        SoaIndexArray.add(sa, &body);
+    }
+
+    // hot records are packed back to back: four per cache line
+    char *hot = SoaIndexArray.column(sa, SOA_HOT);
+    Assert.isTrue((char *)SoaIndexArray.field_at(sa, 3, SOA_HOT) == hot + 3 * hot_size,
+                  "Hot part should be densely packed");
+    test_body *h = SoaIndexArray.field_at(sa, 3, SOA_HOT);  // hot prefix shares the record layout
+    h->mass = 5.0f;
+
+    test_body out;
+    SoaIndexArray.get_at(sa, 3, &out);
+    Assert.isTrue(out.mass == 5.0f, "Hot write should be visible in the gathered record");
+    Assert.areEqual(&(int){3}, &out.id, INT, "Cold part should be gathered under the same index");
+    Assert.isTrue(strcmp(out.name, "cold") == 0, "Cold part mismatch");
+
+    SoaIndexArray.dispose(sa);
+}
+
+static void test_soa_iterator(void) {
+    soa_indexarray sa = SoaIndexArray.new(8, body_fields, 4, sizeof(test_body));
+    for (int i = 0; i < 8; i++) {
+        test_body body = {0, 0, 0, 0, i, ""};
+        SoaIndexArray.add(sa, &body);
+    }
+    for (usize i = 0; i < 8; i += 2) {
+        SoaIndexArray.remove_at(sa, i);
+    }
+
+    int seen = 0, visited = 0;
+    sparse_iterator it = SoaIndexArray.create_iterator(sa);
+    Assert.isNotNull(it, "Iterator creation failed");
+    while (SparseIterator.next(it)) {
+        test_body out;
+        SparseIterator.current_value(it, (object *)&out);
+        seen |= 1 << out.id;
+        visited++;
+    }
+    Assert.areEqual(&(int){4}, &visited, INT, "Should visit 4 live records");
+    Assert.areEqual(&(int){0xAA}, &seen, INT, "Should visit every odd id");
+
+    SoaIndexArray.clear(sa);
+    Assert.areEqual(&(usize){0}, &(usize){SoaIndexArray.count(sa)}, LONG, "Clear should empty it");
+    Assert.isTrue(SoaIndexArray.is_empty_slot(sa, 1), "Cleared slot should be empty");
+
+    SparseIterator.dispose(it);
+    SoaIndexArray.dispose(sa);
+}
+
+//  register test cases
+static void register_soa_indexarray_tests(void) {
+    testset("core_soa_indexarray_set", set_config, set_teardown);
+    DebugLogger.log("Test Source: %s", __FILE__);
+
+    testcase("soa_gather_scatter", test_soa_gather_scatter);
+    testcase("soa_columns", test_soa_columns);
+    testcase("soa_hot_cold_split", test_soa_hot_cold_split);
+    testcase("soa_iterator", test_soa_iterator);
+}
+__attribute__((constructor)) static void enqueue_soa_indexarray_tests(void) {
+    Tests.enqueue(register_soa_indexarray_tests);
+}
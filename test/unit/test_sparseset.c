@@ -0,0 +1,146 @@
+/*
+ *  Test File: test_sparseset.c
+ *  Description: Test cases for SparseSet collection and SparseJoin
+ */
+
+#include <sigma.test/sigtest.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "collections.h"
+#include "sparseset.h"
+
+typedef struct test_position {
+    float x, y;
+} test_position;
+
+//  configure test set
+static void set_config(FILE **log_stream) { *log_stream = fopen("logs/test_sparseset.log", "w"); }
+static void set_teardown(void) {}
+
+static void test_sparseset_insert_remove(void) {
+    sparseset ss = SparseSet.new(2, sizeof(test_position));
+    Assert.isNotNull(ss, "SparseSet creation failed");
+
+    // ids need not be dense; the sparse table grows to cover them
+    uint32_t ids[] = {5, 1000, 42, 7};
+    for (int i = 0; i < 4; i++) {
+        test_position p = {(float)ids[i], 0};
+        Assert.areEqual(&(int){OK}, &(int){SparseSet.insert(ss, ids[i], &p)}, INT, "Insert failed");
+    }
+    Assert.areEqual(&(usize){4}, &(usize){SparseSet.count(ss)}, LONG, "Count should be 4");
+    Assert.isTrue(SparseSet.contains(ss, 1000), "1000 should be present");
+    Assert.isFalse(SparseSet.contains(ss, 6), "6 should not be present");
+    Assert.isFalse(SparseSet.contains(ss, 5000), "Ids past the sparse table are absent");
+
+    // insert on a present id overwrites in place
+    test_position moved = {1.5f, 2.5f};
+    SparseSet.insert(ss, 42, &moved);
+    Assert.areEqual(&(usize){4}, &(usize){SparseSet.count(ss)}, LONG, "Overwrite must not add");
+    test_position *ptr = SparseSet.get_ptr(ss, 42);
+    Assert.isNotNull(ptr, "get_ptr failed");
+    Assert.isTrue(ptr->y == 2.5f, "Component not overwritten");
+
+    // removal swaps the last dense entry into the hole
+    Assert.areEqual(&(int){OK}, &(int){SparseSet.remove(ss, 5)}, INT, "Remove failed");
+    Assert.areEqual(&(int){ERR}, &(int){SparseSet.remove(ss, 5)}, INT, "Double remove should fail");
+    const uint32_t *entities = SparseSet.entities(ss);
+    test_position *components = SparseSet.components(ss);
+    Assert.areEqual(&(int){7}, &(int){(int)entities[0]}, INT, "Last entity should fill the hole");
+    Assert.isTrue(components[0].x == 7.0f, "Component should move with its entity");
+
+    test_position out;
+    Assert.areEqual(&(int){OK}, &(int){SparseSet.get(ss, 7, &out)}, INT, "Moved entity lookup failed");
+    Assert.isTrue(out.x == 7.0f, "Moved entity resolved to wrong component");
+
+    SparseSet.clear(ss);
+    Assert.areEqual(&(usize){0}, &(usize){SparseSet.count(ss)}, LONG, "Clear should empty the set");
+    Assert.isFalse(SparseSet.contains(ss, 7), "Clear should drop every entity");
+
+    SparseSet.dispose(ss);
+}
+
+static void test_sparseset_tag_set(void) {
+    sparseset tags = SparseSet.new(0, 0);
+    Assert.isNotNull(tags, "Tag set creation failed");
+    for (uint32_t e = 0; e < 20; e++) {
+        SparseSet.insert(tags, e * 3, NULL);
+    }
+    Assert.areEqual(&(usize){20}, &(usize){SparseSet.count(tags)}, LONG, "Count should be 20");
+    Assert.isTrue(SparseSet.contains(tags, 57), "57 should be tagged");
+    Assert.isTrue(SparseSet.get_ptr(tags, 57) == NULL, "Tag sets have no component storage");
+    Assert.isTrue(SparseSet.components(tags) == NULL, "Tag sets have no component storage");
+    SparseSet.dispose(tags);
+}
+
+static void test_sparseset_join(void) {
+    sparseset positions = SparseSet.new(8, sizeof(test_position));
+    sparseset velocities = SparseSet.new(8, sizeof(test_position));
+    sparseset frozen = SparseSet.new(8, 0);
+
+    for (uint32_t e = 0; e < 30; e++) {
+        test_position p = {(float)e, 0};
+        SparseSet.insert(positions, e, &p);
+        if (e % 3 == 0) {
+            test_position v = {1, 1};
+            SparseSet.insert(velocities, e, &v);
+        }
+        if (e % 2 == 0) {
+            SparseSet.insert(frozen, e, NULL);
+        }
+    }
+
+    // entities with position and velocity: multiples of 3
+    sparseset moving[] = {positions, velocities};
+    sparse_join join = SparseJoin.new(moving, 2);
+    Assert.isNotNull(join, "Join creation failed");
+    int matched = 0;
+    while (SparseJoin.next(join)) {
+        uint32_t e = SparseJoin.entity(join);
+        Assert.isTrue(e % 3 == 0, "Entity %u lacks a velocity", e);
+        test_position *p = SparseJoin.component(join, 0);
+        test_position *v = SparseJoin.component(join, 1);
+        Assert.isTrue(p->x == (float)e, "Position belongs to another entity");
+        p->x += v->x;
+        matched++;
+    }
+    Assert.areEqual(&(int){10}, &matched, INT, "Should match 10 entities");
+    Assert.isTrue(((test_position *)SparseSet.get_ptr(positions, 9))->x == 10.0f,
+                  "Join should write through to dense storage");
+    SparseJoin.dispose(join);
+
+    // three-way join removing the current entity as it goes: multiples of 6
+    sparseset sets[] = {positions, velocities, frozen};
+    join = SparseJoin.new(sets, 3);
+    matched = 0;
+    while (SparseJoin.next(join)) {
+        Assert.isTrue(SparseJoin.entity(join) % 6 == 0, "Entity should be a multiple of 6");
+        Assert.isTrue(SparseJoin.component(join, 2) == NULL, "Tag set yields no component");
+        SparseSet.remove(velocities, SparseJoin.entity(join));
+        matched++;
+    }
+    Assert.areEqual(&(int){5}, &matched, INT, "Should match 5 entities");
+    Assert.areEqual(&(usize){5}, &(usize){SparseSet.count(velocities)}, LONG,
+                    "Matched entities should be removed");
+
+    SparseJoin.reset(join);
+    Assert.isFalse(SparseJoin.next(join), "No entity is left in all three sets");
+    SparseJoin.dispose(join);
+
+    SparseSet.dispose(frozen);
+    SparseSet.dispose(velocities);
+    SparseSet.dispose(positions);
+}
+
+//  register test cases
+static void register_sparseset_tests(void) {
+    testset("core_sparseset_set", set_config, set_teardown);
+    DebugLogger.log("Test Source: %s", __FILE__);
+
+    testcase("sparseset_insert_remove", test_sparseset_insert_remove);
+    testcase("sparseset_tag_set", test_sparseset_tag_set);
+    testcase("sparseset_join", test_sparseset_join);
+}
+__attribute__((constructor)) static void enqueue_sparseset_tests(void) {
+    Tests.enqueue(register_sparseset_tests);
+}